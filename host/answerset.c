@@ -0,0 +1,77 @@
+#include "answerset.h"
+
+void set_fill(struct answer_set *set, uint16_t count) {
+    set_clear(set);
+    memset(set->words, 0xff, count / 64 * sizeof *set->words);
+    if(count % 64) set->words[count / 64] = ((uint64_t)1 << (count % 64)) - 1;
+}
+
+int32_t set_next(const struct answer_set *set, uint16_t i) {
+    if(i >= MAX_SET_ANSWERS) return -1;
+    uint8_t w = i / 64;
+    uint64_t bits = set->words[w] & ~(uint64_t)0 << (i % 64);
+    while(!bits) {
+        if(++w == ANSWER_SET_WORDS) return -1;
+        bits = set->words[w];
+    }
+    return w * 64 + __builtin_ctzll(bits);
+}
+
+uint16_t set_members(const struct answer_set *set, uint16_t *members) {
+    uint16_t count = 0;
+    for(uint8_t w = 0; w < ANSWER_SET_WORDS; w++) {
+        for(uint64_t bits = set->words[w]; bits; bits &= bits - 1) {
+            members[count++] = w * 64 + __builtin_ctzll(bits);
+        }
+    }
+    return count;
+}
+
+void set_histogram(const struct answer_set *set, const uint8_t *row, uint16_t counts[NUM_SCORES]) {
+    memset(counts, 0, NUM_SCORES * sizeof *counts);
+    for(uint8_t w = 0; w < ANSWER_SET_WORDS; w++) {
+        const uint8_t *scores = row + w * 64;
+        if(set->words[w] == ~(uint64_t)0) {
+            // Full words are common near the root of a search, and quicker without finding each bit
+            for(uint8_t b = 0; b < 64; b++) counts[scores[b]]++;
+            continue;
+        }
+        for(uint64_t bits = set->words[w]; bits; bits &= bits - 1) {
+            counts[scores[__builtin_ctzll(bits)]]++;
+        }
+    }
+}
+
+void set_filter(struct answer_set *set, const uint8_t *row, uint8_t score) {
+    for(uint8_t w = 0; w < ANSWER_SET_WORDS; w++) {
+        const uint8_t *scores = row + w * 64;
+        uint64_t keep = 0;
+        for(uint64_t bits = set->words[w]; bits; bits &= bits - 1) {
+            uint8_t b = __builtin_ctzll(bits);
+            if(scores[b] == score) keep |= (uint64_t)1 << b;
+        }
+        set->words[w] = keep;
+    }
+}
+
+uint8_t set_partition(const struct answer_set *set, const uint8_t *row, struct answer_set parts[NUM_SCORES],
+                      uint8_t *scores) {
+    bool used[NUM_SCORES] = {false};
+    for(uint8_t w = 0; w < ANSWER_SET_WORDS; w++) {
+        const uint8_t *row_scores = row + w * 64;
+        for(uint64_t bits = set->words[w]; bits; bits &= bits - 1) {
+            uint8_t b = __builtin_ctzll(bits);
+            uint8_t score = row_scores[b];
+            if(!used[score]) {
+                used[score] = true;
+                set_clear(&parts[score]);
+            }
+            parts[score].words[w] |= (uint64_t)1 << b;
+        }
+    }
+    uint8_t count = 0;
+    for(uint16_t s = 0; s < NUM_SCORES; s++) {
+        if(used[s]) scores[count++] = s;
+    }
+    return count;
+}
@@ -0,0 +1,80 @@
+#ifndef WORDLE_HOST_ANSWERSET_H
+#define WORDLE_HOST_ANSWERSET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "wordle.h"
+
+// A set of answers as one bit per matrix column (see matrix.h), 64 at a time, so that narrowing down and counting
+// are a few dozen word operations instead of a walk over a list of indices.
+
+#define ANSWER_SET_WORDS 37
+#define MAX_SET_ANSWERS (ANSWER_SET_WORDS * 64)
+
+struct answer_set {
+    uint64_t words[ANSWER_SET_WORDS];
+};
+
+// The first count answers
+void set_fill(struct answer_set *set, uint16_t count);
+
+static inline void set_clear(struct answer_set *set) {
+    memset(set, 0, sizeof *set);
+}
+
+static inline void set_add(struct answer_set *set, uint16_t i) {
+    set->words[i / 64] |= (uint64_t)1 << (i % 64);
+}
+
+static inline void set_remove(struct answer_set *set, uint16_t i) {
+    set->words[i / 64] &= ~((uint64_t)1 << (i % 64));
+}
+
+static inline bool set_has(const struct answer_set *set, uint16_t i) {
+    return set->words[i / 64] >> (i % 64) & 1;
+}
+
+static inline uint16_t set_count(const struct answer_set *set) {
+    uint16_t count = 0;
+    for(uint8_t w = 0; w < ANSWER_SET_WORDS; w++) {
+        count += __builtin_popcountll(set->words[w]);
+    }
+    return count;
+}
+
+static inline void set_and(struct answer_set *result, const struct answer_set *a, const struct answer_set *b) {
+    for(uint8_t w = 0; w < ANSWER_SET_WORDS; w++) {
+        result->words[w] = a->words[w] & b->words[w];
+    }
+}
+
+static inline void set_and_not(struct answer_set *result, const struct answer_set *a, const struct answer_set *b) {
+    for(uint8_t w = 0; w < ANSWER_SET_WORDS; w++) {
+        result->words[w] = a->words[w] & ~b->words[w];
+    }
+}
+
+static inline bool set_equal(const struct answer_set *a, const struct answer_set *b) {
+    return memcmp(a, b, sizeof *a) == 0;
+}
+
+// Lowest member at or after i, or -1 if there is none
+int32_t set_next(const struct answer_set *set, uint16_t i);
+
+// Writes the members in increasing order, returning how many there are
+uint16_t set_members(const struct answer_set *set, uint16_t *members);
+
+// Number of members with each score in a matrix row
+void set_histogram(const struct answer_set *set, const uint8_t *row, uint16_t counts[NUM_SCORES]);
+
+// Keeps only the members with the given score in a matrix row
+void set_filter(struct answer_set *set, const uint8_t *row, uint8_t score);
+
+// Splits a set by the scores in a matrix row. parts[s] is written for each score s that occurs, and those scores
+// are listed in increasing order in scores. Returns how many there are.
+uint8_t set_partition(const struct answer_set *set, const uint8_t *row, struct answer_set parts[NUM_SCORES],
+                      uint8_t *scores);
+
+#endif //WORDLE_HOST_ANSWERSET_H
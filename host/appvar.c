@@ -0,0 +1,88 @@
+#include "appvar.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// See tools/tifile.py for the file layout
+#define SIGNATURE "**TI83F*\x1a\x0a\x00"
+#define ENTRY_OFFSET 55
+#define COMMENT_LENGTH 42
+#define VAR_HEADER_LENGTH 13
+#define TYPE_APPVAR 0x15
+#define FLAG_ARCHIVED 0x80
+
+static uint16_t read_u16(const uint8_t *ptr) {
+    return ptr[0] | ptr[1] << 8;
+}
+
+void *load_appvar(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if(!f) {
+        perror(path);
+        exit(1);
+    }
+    static const size_t max_size = 0x20000;
+    uint8_t *file = malloc(max_size);
+    size_t size = fread(file, 1, max_size, f);
+    fclose(f);
+
+    if(size < ENTRY_OFFSET + 2 || memcmp(file, SIGNATURE, sizeof SIGNATURE - 1) != 0) {
+        fprintf(stderr, "%s: not a TI variable file\n", path);
+        exit(1);
+    }
+    const uint8_t *entry = file + ENTRY_OFFSET;
+    uint16_t header_length = read_u16(entry);
+    uint16_t var_length = read_u16(entry + 2 + header_length);
+    const uint8_t *var_data = entry + 4 + header_length;
+    if(var_data + var_length > file + size) {
+        fprintf(stderr, "%s: truncated\n", path);
+        exit(1);
+    }
+
+    uint8_t *data = malloc(var_length);
+    memcpy(data, var_data, var_length);
+    free(file);
+    return data;
+}
+
+static void write_u16(uint8_t *ptr, uint16_t value) {
+    ptr[0] = value;
+    ptr[1] = value >> 8;
+}
+
+bool save_appvar(const char *path, const char *name, const void *contents, uint16_t size) {
+    if(size > 0xffff - 2 - 2 - VAR_HEADER_LENGTH) {
+        errno = EFBIG;
+        return false;
+    }
+    uint16_t var_length = size + 2;
+    uint16_t entry_length = 2 + VAR_HEADER_LENGTH + 2 + var_length;
+    uint8_t *entry = calloc(entry_length, 1);
+    write_u16(entry, VAR_HEADER_LENGTH);
+    write_u16(entry + 2, var_length);
+    entry[4] = TYPE_APPVAR;
+    strncpy((char*)entry + 5, name, 8);
+    entry[14] = FLAG_ARCHIVED;
+    write_u16(entry + 15, var_length);
+    write_u16(entry + 17, size);
+    memcpy(entry + 19, contents, size);
+
+    uint8_t header[sizeof SIGNATURE - 1 + COMMENT_LENGTH + 2] = {0};
+    memcpy(header, SIGNATURE, sizeof SIGNATURE - 1);
+    write_u16(header + sizeof header - 2, entry_length);
+    uint16_t checksum = 0;
+    for(uint16_t i = 0; i < entry_length; i++) {
+        checksum += entry[i];
+    }
+    uint8_t footer[2];
+    write_u16(footer, checksum);
+
+    FILE *f = fopen(path, "wb");
+    bool ok = f && fwrite(header, sizeof header, 1, f) == 1 && fwrite(entry, entry_length, 1, f) == 1 &&
+              fwrite(footer, sizeof footer, 1, f) == 1;
+    if(f && fclose(f) != 0) ok = false;
+    free(entry);
+    return ok;
+}
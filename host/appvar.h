@@ -0,0 +1,14 @@
+#ifndef WORDLE_HOST_APPVAR_H
+#define WORDLE_HOST_APPVAR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Loads the data of an appvar from a .8xv file, in the same layout as os_GetAppVarData returns on the calculator:
+// a uint16_t size followed by the contents. Exits with an error message if the file can't be read.
+void *load_appvar(const char *path);
+
+// Writes an archived appvar with the given contents, like tools/tifile.py. Returns false with errno set on failure.
+bool save_appvar(const char *path, const char *name, const void *contents, uint16_t size);
+
+#endif //WORDLE_HOST_APPVAR_H
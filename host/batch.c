@@ -0,0 +1,165 @@
+#include "batch.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "game.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BATCH_X86
+#endif
+
+#ifdef BATCH_X86
+
+// What each tile of a guess is compared against, worked out once per guess
+struct guess_info {
+    uint8_t letters[WORD_LENGTH];
+    // Earlier tiles with the same letter, each of which uses up one occurrence
+    uint8_t seen[WORD_LENGTH];
+    // Bit i is set if tile i has a different letter, so that a match there isn't taken by a correct tile
+    uint8_t others[WORD_LENGTH];
+    uint8_t place[WORD_LENGTH];
+};
+
+static void guess_info_init(struct guess_info *info, const char *guess) {
+    uint8_t place = 1;
+    for(uint8_t j = 0; j < WORD_LENGTH; j++) {
+        info->letters[j] = guess[j];
+        info->seen[j] = 0;
+        info->others[j] = 0;
+        for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+            if(guess[i] != guess[j]) info->others[j] |= 1 << i;
+            else if(i < j) info->seen[j]++;
+        }
+        info->place[j] = place;
+        place *= 3;
+    }
+}
+
+#endif
+
+void columns_init(struct answer_columns *columns, const char (*answers)[WORD_LENGTH], uint32_t count) {
+    columns->count = count;
+    columns->stride = (count + BATCH_LANES - 1) / BATCH_LANES * BATCH_LANES;
+    // Keeps the allocation non-empty, and a whole number of lanes
+    size_t size = columns->stride ? columns->stride : BATCH_LANES;
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        columns->letters[i] = aligned_alloc(BATCH_LANES, size);
+        memset(columns->letters[i], 0, size);
+        for(uint32_t n = 0; n < count; n++) {
+            columns->letters[i][n] = answers[n][i];
+        }
+    }
+}
+
+void columns_free(struct answer_columns *columns) {
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        free(columns->letters[i]);
+        columns->letters[i] = NULL;
+    }
+}
+
+// Plain C has no byte lanes to compare, so gathering each answer and scoring the pair is quicker
+static void score_scalar(const char *guess, const struct answer_columns *columns, uint8_t *scores) {
+    for(uint32_t n = 0; n < columns->count; n++) {
+        char answer[WORD_LENGTH];
+        for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+            answer[i] = columns->letters[i][n];
+        }
+        scores[n] = score_guess(guess, answer);
+    }
+}
+
+#ifdef BATCH_X86
+
+// Compare masks are all ones, so subtracting one counts a match. The counts and scores never pass 242, so bytes are
+// wide enough for both.
+
+static void score_sse2(const struct guess_info *info, const struct answer_columns *columns, uint8_t *scores) {
+    for(uint32_t n = 0; n < columns->stride; n += 16) {
+        __m128i answer[WORD_LENGTH];
+        for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+            answer[i] = _mm_load_si128((const __m128i*)&columns->letters[i][n]);
+        }
+        __m128i score = _mm_setzero_si128();
+        for(uint8_t j = 0; j < WORD_LENGTH; j++) {
+            __m128i letter = _mm_set1_epi8(info->letters[j]);
+            __m128i correct = _mm_cmpeq_epi8(answer[j], letter);
+            __m128i count = _mm_setzero_si128();
+            for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+                if(info->others[j] >> i & 1) count = _mm_sub_epi8(count, _mm_cmpeq_epi8(answer[i], letter));
+            }
+            __m128i present = _mm_andnot_si128(correct, _mm_cmpgt_epi8(count, _mm_set1_epi8(info->seen[j])));
+            score = _mm_add_epi8(score, _mm_and_si128(correct, _mm_set1_epi8(2 * info->place[j])));
+            score = _mm_add_epi8(score, _mm_and_si128(present, _mm_set1_epi8(info->place[j])));
+        }
+        _mm_storeu_si128((__m128i*)&scores[n], score);
+    }
+}
+
+__attribute__((target("avx2")))
+static void score_avx2(const struct guess_info *info, const struct answer_columns *columns, uint8_t *scores) {
+    for(uint32_t n = 0; n < columns->stride; n += 32) {
+        __m256i answer[WORD_LENGTH];
+        for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+            answer[i] = _mm256_load_si256((const __m256i*)&columns->letters[i][n]);
+        }
+        __m256i score = _mm256_setzero_si256();
+        for(uint8_t j = 0; j < WORD_LENGTH; j++) {
+            __m256i letter = _mm256_set1_epi8(info->letters[j]);
+            __m256i correct = _mm256_cmpeq_epi8(answer[j], letter);
+            __m256i count = _mm256_setzero_si256();
+            for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+                if(info->others[j] >> i & 1) count = _mm256_sub_epi8(count, _mm256_cmpeq_epi8(answer[i], letter));
+            }
+            __m256i present = _mm256_andnot_si256(correct,
+                                                  _mm256_cmpgt_epi8(count, _mm256_set1_epi8(info->seen[j])));
+            score = _mm256_add_epi8(score, _mm256_and_si256(correct, _mm256_set1_epi8(2 * info->place[j])));
+            score = _mm256_add_epi8(score, _mm256_and_si256(present, _mm256_set1_epi8(info->place[j])));
+        }
+        _mm256_storeu_si256((__m256i*)&scores[n], score);
+    }
+}
+
+#endif
+
+bool batch_supported(enum batch_kernel kernel) {
+    switch(kernel) {
+        case BATCH_SCALAR: return true;
+#ifdef BATCH_X86
+        case BATCH_SSE2: return __builtin_cpu_supports("sse2");
+        case BATCH_AVX2: return __builtin_cpu_supports("avx2");
+#endif
+        default: return false;
+    }
+}
+
+enum batch_kernel batch_best(void) {
+    enum batch_kernel best = NUM_BATCH_KERNELS - 1;
+    while(!batch_supported(best)) best--;
+    return best;
+}
+
+const char *batch_name(enum batch_kernel kernel) {
+    static const char *names[NUM_BATCH_KERNELS] = {"scalar", "sse2", "avx2"};
+    return names[kernel];
+}
+
+void batch_score_with(enum batch_kernel kernel, const char *guess, const struct answer_columns *columns,
+                      uint8_t *scores) {
+#ifdef BATCH_X86
+    struct guess_info info;
+    guess_info_init(&info, guess);
+    switch(kernel) {
+        case BATCH_SSE2: score_sse2(&info, columns, scores); return;
+        case BATCH_AVX2: score_avx2(&info, columns, scores); return;
+        default: break;
+    }
+#endif
+    score_scalar(guess, columns, scores);
+}
+
+void batch_score(const char *guess, const struct answer_columns *columns, uint8_t *scores) {
+    batch_score_with(batch_best(), guess, columns, scores);
+}
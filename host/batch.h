@@ -0,0 +1,45 @@
+#ifndef WORDLE_HOST_BATCH_H
+#define WORDLE_HOST_BATCH_H
+
+#include <stdint.h>
+
+#include "wordle.h"
+
+// Scores one guess against many answers at once, giving the same results as score_guess.
+//
+// The answers are stored a letter position at a time, so that a vector register holds the same letter of 16 or 32
+// answers. Since every earlier tile with the same letter uses one up whatever its color, whether a tile is present
+// only depends on how many times its letter is in the rest of the answer, which is a sum of byte compares.
+
+// Lanes in the widest kernel. Columns are padded to a multiple of this.
+#define BATCH_LANES 32
+
+struct answer_columns {
+    uint32_t count;
+    // count rounded up to BATCH_LANES
+    uint32_t stride;
+    // Letter i of each answer, padded with zeros
+    uint8_t *letters[WORD_LENGTH];
+};
+
+enum batch_kernel {
+    BATCH_SCALAR,
+    BATCH_SSE2,
+    BATCH_AVX2,
+    NUM_BATCH_KERNELS
+};
+
+void columns_init(struct answer_columns *columns, const char (*answers)[WORD_LENGTH], uint32_t count);
+void columns_free(struct answer_columns *columns);
+
+// Fastest kernel the CPU supports
+enum batch_kernel batch_best(void);
+bool batch_supported(enum batch_kernel kernel);
+const char *batch_name(enum batch_kernel kernel);
+
+// Writes columns->stride scores, the ones past count being meaningless. The scalar kernel only writes count.
+void batch_score(const char *guess, const struct answer_columns *columns, uint8_t *scores);
+void batch_score_with(enum batch_kernel kernel, const char *guess, const struct answer_columns *columns,
+                      uint8_t *scores);
+
+#endif //WORDLE_HOST_BATCH_H
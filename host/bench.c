@@ -0,0 +1,216 @@
+// Times the game's scoring and word list paths natively, using the same appvars as the calculator, and the thread pool
+// the other host tools share out their work with.
+// Usage: bench WORDS.8xv ANSWERS.8xv [HINTS.8xv]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "answerset.h"
+#include "appvar.h"
+#include "batch.h"
+#include "candidates.h"
+#include "constraints.h"
+#include "game.h"
+#include "hint.h"
+#include "pool.h"
+#include "util.h"
+#include "wordlist.h"
+#include "words.h"
+
+// Stops the compiler from optimizing away work whose result isn't otherwise used
+static volatile uint32_t sink;
+
+static void report(const char *name, double start, uint32_t ops) {
+    double elapsed = now() - start;
+    printf("%-24s %10u ops %10.3f ms %10.1f ns/op\n", name, ops, elapsed * 1e3, elapsed * 1e9 / ops);
+}
+
+struct pool_check {
+    uint8_t *runs;
+    uint32_t *results;
+};
+
+static void check_task(void *ctx, size_t task, unsigned worker) {
+    (void)worker;
+    struct pool_check *check = ctx;
+    // Uneven amounts of work, so that workers run out at different times and have to steal
+    uint32_t x = task;
+    for(size_t i = 0; i < task % 64 * 16; i++) {
+        x = x * 1103515245 + 12345;
+    }
+    check->results[task] = x;
+    __atomic_add_fetch(&check->runs[task], 1, __ATOMIC_RELAXED);
+}
+
+int main(int argc, char **argv) {
+    if(argc < 3 || argc > 4) {
+        fprintf(stderr, "usage: %s WORDS.8xv ANSWERS.8xv [HINTS.8xv]\n", argv[0]);
+        return 2;
+    }
+    if(!wordlist_init(load_appvar(argv[1]))) {
+        fprintf(stderr, "%s: unsupported word list\n", argv[1]);
+        return 1;
+    }
+    if(!answers_init(load_appvar(argv[2]))) {
+        fprintf(stderr, "%s: unsupported or mismatched answer list\n", argv[2]);
+        return 1;
+    }
+    if(argc > 3 && !hint_init(load_appvar(argv[3]))) {
+        fprintf(stderr, "%s: unsupported or mismatched hint tree\n", argv[3]);
+        return 1;
+    }
+    printf("%u words, %u answers\n", num_words, num_answers);
+
+    char (*words)[WORD_LENGTH] = malloc((size_t)num_words * WORD_LENGTH);
+    char (*answers)[WORD_LENGTH] = malloc((size_t)num_answers * WORD_LENGTH);
+
+    double start = now();
+    for(uint16_t i = 0; i < num_words; i++) {
+        wordlist_get(i, words[i]);
+    }
+    report("wordlist_get", start, num_words);
+
+    start = now();
+    for(uint16_t i = 0; i < num_answers; i++) {
+        get_answer(i, answers[i]);
+    }
+    report("get_answer", start, num_answers);
+
+    start = now();
+    uint32_t found = 0;
+    for(uint16_t i = 0; i < num_words; i++) {
+        found += is_word_in_list(words[i]);
+    }
+    // Misses take a different path through the search, so try each word with its last letter changed as well
+    for(uint16_t i = 0; i < num_words; i++) {
+        char word[WORD_LENGTH];
+        memcpy(word, words[i], WORD_LENGTH);
+        word[WORD_LENGTH - 1] = word[WORD_LENGTH - 1] == 'Z' ? 'A' : word[WORD_LENGTH - 1] + 1;
+        found += is_word_in_list(word);
+    }
+    sink = found;
+    report("is_word_in_list", start, 2 * num_words);
+
+    start = now();
+    uint32_t total = 0;
+    for(uint16_t i = 0; i < num_answers; i++) {
+        for(uint16_t j = 0; j < num_answers; j++) {
+            total += score_guess(answers[i], answers[j]);
+        }
+    }
+    sink = total;
+    report("score_guess", start, (uint32_t)num_answers * num_answers);
+
+    // The same pairs through each batch kernel, which also have to agree with score_guess
+    struct answer_columns columns;
+    columns_init(&columns, answers, num_answers);
+    uint8_t *batch_scores = aligned_alloc(BATCH_LANES, columns.stride);
+    for(enum batch_kernel kernel = 0; kernel < NUM_BATCH_KERNELS; kernel++) {
+        if(!batch_supported(kernel)) continue;
+        char name[24];
+        snprintf(name, sizeof name, "batch_score (%s)", batch_name(kernel));
+        start = now();
+        for(uint16_t i = 0; i < num_answers; i++) {
+            batch_score_with(kernel, answers[i], &columns, batch_scores);
+            sink = batch_scores[i];
+        }
+        report(name, start, (uint32_t)num_answers * num_answers);
+        for(uint16_t i = 0; i < num_answers; i++) {
+            batch_score_with(kernel, answers[i], &columns, batch_scores);
+            for(uint16_t j = 0; j < num_answers; j++) {
+                if(batch_scores[j] != score_guess(answers[i], answers[j])) {
+                    fprintf(stderr, "%s: wrong score for %.5s against %.5s\n", name, answers[i], answers[j]);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    // Splitting every answer by each answer's feedback, the core step of a tree search. Days map to columns one to
+    // one here, which is enough to time it.
+    if(num_answers <= MAX_SET_ANSWERS) {
+        struct answer_set all;
+        struct answer_set *parts = malloc(NUM_SCORES * sizeof *parts);
+        uint8_t used[NUM_SCORES];
+        set_fill(&all, num_answers);
+        total = 0;
+        start = now();
+        for(uint16_t i = 0; i < num_answers; i++) {
+            batch_score(answers[i], &columns, batch_scores);
+            total += set_partition(&all, batch_scores, parts, used);
+        }
+        sink = total;
+        report("batch + set_partition", start, num_answers);
+        free(parts);
+    }
+    columns_free(&columns);
+    free(batch_scores);
+
+    // Hard mode validation against a board with a couple of rows on it
+    char guesses[MAX_GUESSES][WORD_LENGTH] = {{0}};
+    enum tile_type tiles[MAX_GUESSES][WORD_LENGTH];
+    struct constraints constraints;
+    constraints_init(&constraints);
+    for(uint8_t row = 0; row < 2; row++) {
+        memcpy(guesses[row], answers[row * 7], WORD_LENGTH);
+        score_row(tiles[row], guesses, row, answers[0]);
+        constraints_add(&constraints, guesses[row], tiles[row]);
+    }
+    start = now();
+    uint32_t valid = 0;
+    for(uint16_t i = 0; i < num_words; i++) {
+        memcpy(guesses[2], words[i], WORD_LENGTH);
+        valid += !validate_word(guesses, 2, &constraints, SETTING_HARD);
+    }
+    sink = valid;
+    report("validate_word (hard)", start, num_words);
+
+    start = now();
+    candidates_init();
+    candidates_add(guesses[0], score_guess(guesses[0], answers[0]));
+    while(candidates_pending()) {
+        candidates_update(16);
+    }
+    report("candidates pass", start, num_answers);
+
+    start = now();
+    candidates_init();
+    hint_start(guesses, tiles, 0, NULL);
+    uint32_t slices = 0;
+    while(hint_running()) {
+        hint_update();
+        slices++;
+    }
+    report("hint from empty board", start, slices ? slices : 1);
+    printf("hint: %s\n", hint_text());
+
+    // Every task has to run exactly once, however many threads there are to steal from each other
+    const size_t num_tasks = 20000;
+    const uint8_t rounds = 4;
+    struct pool_check check = {malloc(num_tasks), malloc(num_tasks * sizeof *check.results)};
+    for(unsigned threads = 1; threads <= 9; threads++) {
+        struct pool *pool = pool_create(threads);
+        char name[24];
+        snprintf(name, sizeof name, "pool_run (%u threads)", threads);
+        double elapsed = 0;
+        for(uint8_t round = 0; round < rounds; round++) {
+            memset(check.runs, 0, num_tasks);
+            start = now();
+            pool_run(pool, num_tasks, check_task, &check);
+            elapsed += now() - start;
+            for(size_t i = 0; i < num_tasks; i++) {
+                if(check.runs[i] != 1) {
+                    fprintf(stderr, "%s: task %zu ran %u times\n", name, i, check.runs[i]);
+                    return 1;
+                }
+            }
+        }
+        report(name, now() - elapsed, num_tasks * rounds);
+        pool_destroy(pool);
+    }
+    free(check.runs);
+    free(check.results);
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include "invindex.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "matrix.h"
+
+// Checks everything the lookups take on trust, so that a corrupt file can't send them outside the mapping or a set
+static const char *check_tables(const struct invindex_header *header, const uint8_t *map) {
+    const uint32_t *guesses = (const uint32_t*)(map + header->guesses_offset);
+    const struct invindex_cell *cells = (const struct invindex_cell*)(map + header->cells_offset);
+    const uint16_t *members = (const uint16_t*)(map + header->members_offset);
+    if(guesses[0] != 0 || guesses[header->num_guesses] != header->num_cells) return "corrupt guess table";
+    for(uint16_t guess = 0; guess < header->num_guesses; guess++) {
+        uint32_t first = guesses[guess];
+        uint32_t end = guesses[guess + 1];
+        if(end < first) return "corrupt guess table";
+        if(end == first) {
+            if(header->num_answers) return "corrupt cell table";
+            continue;
+        }
+        // Groups cover all of the guess's entries, in increasing order of score
+        if(cells[first].start != 0 || cells[end - 1].start >= header->num_answers) return "corrupt cell table";
+        for(uint32_t cell = first + 1; cell < end; cell++) {
+            if(cells[cell].score <= cells[cell - 1].score || cells[cell].start <= cells[cell - 1].start) {
+                return "corrupt cell table";
+            }
+        }
+    }
+    size_t num_members = (size_t)header->num_guesses * header->num_answers;
+    for(size_t i = 0; i < num_members; i++) {
+        if(members[i] >= header->num_answers) return "corrupt member table";
+    }
+    return NULL;
+}
+
+bool invindex_open(struct invindex *index, const char *path) {
+    size_t size;
+    const uint8_t *map = matrix_map(path, sizeof(struct invindex_header), &size);
+    if(!map) return false;
+
+    const struct invindex_header *header = (const void*)map;
+    size_t num_members = (size_t)header->num_guesses * header->num_answers;
+    const char *error = NULL;
+    if(memcmp(header->magic, INVINDEX_MAGIC, sizeof header->magic) != 0) {
+        error = "not an inverted index";
+    } else if(header->version != INVINDEX_VERSION) {
+        error = "unsupported version";
+    } else if(header->num_answers > MAX_SET_ANSWERS ||
+              header->guesses_offset < sizeof *header + header->num_answers * sizeof(uint16_t) ||
+              header->guesses_offset % MATRIX_ALIGN || header->cells_offset % MATRIX_ALIGN ||
+              header->members_offset % MATRIX_ALIGN) {
+        error = "corrupt header";
+    } else if(header->guesses_offset + (header->num_guesses + 1) * sizeof(uint32_t) > size ||
+              header->cells_offset + (size_t)header->num_cells * sizeof(struct invindex_cell) > size ||
+              header->members_offset + num_members * sizeof(uint16_t) > size) {
+        error = "truncated";
+    } else {
+        error = matrix_check_lists(header->num_guesses, (const uint16_t*)(header + 1), header->num_answers,
+                                   header->checksum);
+    }
+    if(!error) error = check_tables(header, map);
+    if(error) {
+        fprintf(stderr, "%s: %s\n", path, error);
+        munmap((void*)map, size);
+        return false;
+    }
+
+    index->header = header;
+    index->answers = (const uint16_t*)(header + 1);
+    index->guesses = (const uint32_t*)(map + header->guesses_offset);
+    index->cells = (const struct invindex_cell*)(map + header->cells_offset);
+    index->members = (const uint16_t*)(map + header->members_offset);
+    index->size = size;
+    return true;
+}
+
+void invindex_close(struct invindex *index) {
+    munmap((void*)index->header, index->size);
+    index->header = NULL;
+}
+
+uint16_t invindex_lookup(const struct invindex *index, uint16_t guess, uint8_t score, const uint16_t **members) {
+    uint32_t min = index->guesses[guess];
+    uint32_t end = index->guesses[guess + 1];
+    uint32_t max = end;
+    while(min < max) {
+        uint32_t mean = (min + max) / 2;
+        if(index->cells[mean].score < score) min = mean + 1;
+        else max = mean;
+    }
+    if(min == end || index->cells[min].score != score) return 0;
+
+    uint16_t start = index->cells[min].start;
+    uint16_t stop = min + 1 < end ? index->cells[min + 1].start : index->header->num_answers;
+    *members = index->members + (size_t)guess * index->header->num_answers + start;
+    return stop - start;
+}
+
+void invindex_filter(const struct invindex *index, struct answer_set *set, uint16_t guess, uint8_t score) {
+    const uint16_t *members;
+    uint16_t count = invindex_lookup(index, guess, score, &members);
+    struct answer_set matching;
+    set_clear(&matching);
+    for(uint16_t i = 0; i < count; i++) {
+        set_add(&matching, members[i]);
+    }
+    set_and(set, set, &matching);
+}
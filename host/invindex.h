@@ -0,0 +1,63 @@
+#ifndef WORDLE_HOST_INVINDEX_H
+#define WORDLE_HOST_INVINDEX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "answerset.h"
+
+// The feedback matrix turned inside out: for each guess and score, the answers that would give that score, built
+// by mkindex. Answers are matrix columns (see matrix.h), and the file checks against the word and answer lists the
+// same way.
+//
+// Stored as compressed sparse rows. Each guess's answers take up num_answers entries of members, grouped by score;
+// cells lists the scores that occur for each guess and where each one's group starts within the guess's entries,
+// and guesses gives the first cell of each guess, with one more at the end. Scores that never occur take no space.
+
+#define INVINDEX_MAGIC "WLINDEX"
+#define INVINDEX_VERSION 1
+
+struct invindex_header {
+    char magic[8];
+    uint16_t version;
+    uint16_t num_guesses;
+    uint16_t num_answers;
+    uint16_t reserved;
+    uint32_t checksum;
+    uint32_t num_cells;
+    // Offsets from the start of the file, each MATRIX_ALIGN aligned
+    uint32_t guesses_offset;
+    uint32_t cells_offset;
+    uint32_t members_offset;
+    uint32_t reserved2;
+};
+
+struct invindex_cell {
+    uint8_t score;
+    uint8_t reserved;
+    // Offset of the cell's answers from the guess's first entry in members
+    uint16_t start;
+};
+
+struct invindex {
+    const struct invindex_header *header;
+    const uint16_t *answers;
+    const uint32_t *guesses;
+    const struct invindex_cell *cells;
+    const uint16_t *members;
+    size_t size;
+};
+
+// Maps an index file, after the word and answer lists are loaded. Prints a message and returns false if it can't be
+// read, or was built from different lists.
+bool invindex_open(struct invindex *index, const char *path);
+void invindex_close(struct invindex *index);
+
+// The answers that give a score for a guess, in increasing order. Returns how many there are.
+uint16_t invindex_lookup(const struct invindex *index, uint16_t guess, uint8_t score, const uint16_t **members);
+
+// Keeps only the members of a set that give a score for a guess
+void invindex_filter(const struct invindex *index, struct answer_set *set, uint16_t guess, uint8_t score);
+
+#endif //WORDLE_HOST_INVINDEX_H
@@ -0,0 +1,178 @@
+#include "matrix.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "wordlist.h"
+#include "words.h"
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME  16777619u
+
+static uint32_t fnv1a(uint32_t hash, const void *data, size_t size) {
+    const uint8_t *bytes = data;
+    for(size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+uint32_t matrix_checksum(const uint16_t *answers, uint16_t num_answers) {
+    uint32_t hash = FNV_OFFSET;
+    for(uint16_t i = 0; i < num_words; i++) {
+        char word[WORD_LENGTH];
+        wordlist_get(i, word);
+        hash = fnv1a(hash, word, WORD_LENGTH);
+    }
+    for(uint16_t i = 0; i < num_answers; i++) {
+        uint8_t bytes[2] = {answers[i], answers[i] >> 8};
+        hash = fnv1a(hash, bytes, sizeof bytes);
+    }
+    return hash;
+}
+
+uint16_t matrix_answers(uint16_t *answers) {
+    static uint8_t seen[1 << 16];
+    memset(seen, 0, sizeof seen);
+    for(uint16_t day = 0; day < num_answers; day++) {
+        seen[get_answer_index(day)] = 1;
+    }
+    uint16_t count = 0;
+    for(uint32_t i = 0; i < num_words; i++) {
+        if(seen[i]) answers[count++] = i;
+    }
+    return count;
+}
+
+void matrix_init_header(struct matrix_header *header, const uint16_t *answers, uint16_t count) {
+    memset(header, 0, sizeof *header);
+    memcpy(header->magic, MATRIX_MAGIC, sizeof header->magic);
+    header->version = MATRIX_VERSION;
+    header->num_guesses = num_words;
+    header->num_answers = count;
+    header->row_stride = (count + MATRIX_ALIGN - 1) / MATRIX_ALIGN * MATRIX_ALIGN;
+    uint32_t answers_end = sizeof *header + count * sizeof *answers;
+    header->data_offset = (answers_end + MATRIX_ALIGN - 1) / MATRIX_ALIGN * MATRIX_ALIGN;
+    header->checksum = matrix_checksum(answers, count);
+}
+
+const char *matrix_check_lists(uint16_t num_guesses, const uint16_t *answers, uint16_t count, uint32_t checksum) {
+    if(num_guesses != num_words || checksum != matrix_checksum(answers, count)) {
+        return "built from a different word list";
+    }
+    uint16_t expected[1 << 14];
+    if(count != matrix_answers(expected) || memcmp(answers, expected, count * sizeof *answers) != 0) {
+        return "built from a different answer list";
+    }
+    return NULL;
+}
+
+void *matrix_map(const char *path, size_t min_size, size_t *size) {
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) {
+        perror(path);
+        return NULL;
+    }
+    struct stat st;
+    if(fstat(fd, &st) < 0 || (size_t)st.st_size < min_size) {
+        fprintf(stderr, "%s: too small\n", path);
+        close(fd);
+        return NULL;
+    }
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED) {
+        perror(path);
+        return NULL;
+    }
+    *size = st.st_size;
+    return map;
+}
+
+bool matrix_create(struct matrix_output *output, const char *path, size_t size) {
+    output->path = path;
+    output->size = size;
+    output->temp_path = malloc(strlen(path) + 5);
+    sprintf(output->temp_path, "%s.tmp", path);
+    output->fd = open(output->temp_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(output->fd < 0 || ftruncate(output->fd, size) < 0) {
+        perror(output->temp_path);
+        return false;
+    }
+    output->data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, output->fd, 0);
+    if(output->data == MAP_FAILED) {
+        perror(output->temp_path);
+        close(output->fd);
+        unlink(output->temp_path);
+        return false;
+    }
+    return true;
+}
+
+bool matrix_finish(struct matrix_output *output) {
+    bool ok = msync(output->data, output->size, MS_SYNC) == 0;
+    ok = munmap(output->data, output->size) == 0 && ok;
+    ok = close(output->fd) == 0 && ok;
+    if(!ok || rename(output->temp_path, output->path) < 0) {
+        perror(output->path);
+        unlink(output->temp_path);
+        ok = false;
+    }
+    free(output->temp_path);
+    return ok;
+}
+
+bool matrix_open(struct matrix *matrix, const char *path) {
+    size_t size;
+    void *map = matrix_map(path, sizeof(struct matrix_header), &size);
+    if(!map) return false;
+
+    const struct matrix_header *header = map;
+    const char *error = NULL;
+    if(memcmp(header->magic, MATRIX_MAGIC, sizeof header->magic) != 0) {
+        error = "not a feedback matrix";
+    } else if(header->version != MATRIX_VERSION) {
+        error = "unsupported version";
+    } else if(header->data_offset < sizeof *header + header->num_answers * sizeof(uint16_t) ||
+              header->row_stride < header->num_answers) {
+        // The answer list would run into the rows, or each row into the next
+        error = "corrupt header";
+    } else if((size_t)header->data_offset + (size_t)header->num_guesses * header->row_stride > size) {
+        error = "truncated";
+    } else {
+        error = matrix_check_lists(header->num_guesses, (const uint16_t*)(header + 1), header->num_answers,
+                                   header->checksum);
+    }
+    if(error) {
+        fprintf(stderr, "%s: %s\n", path, error);
+        munmap(map, size);
+        return false;
+    }
+
+    matrix->header = header;
+    matrix->answers = (const uint16_t*)(header + 1);
+    matrix->data = (const uint8_t*)map + header->data_offset;
+    matrix->size = size;
+    return true;
+}
+
+void matrix_close(struct matrix *matrix) {
+    munmap((void*)matrix->header, matrix->size);
+    matrix->header = NULL;
+}
+
+int32_t matrix_column(const struct matrix *matrix, uint16_t word) {
+    uint16_t min = 0;
+    uint16_t max = matrix->header->num_answers;
+    while(min < max) {
+        uint16_t mean = (min + max) / 2;
+        if(matrix->answers[mean] < word) min = mean + 1;
+        else max = mean;
+    }
+    return min < matrix->header->num_answers && matrix->answers[min] == word ? min : -1;
+}
@@ -0,0 +1,85 @@
+#ifndef WORDLE_HOST_MATRIX_H
+#define WORDLE_HOST_MATRIX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A file holding score_guess for every word in the list as a guess against every distinct answer, built by mkmatrix
+// and mapped read-only by the tools that use it, so that processes share one copy through the page cache.
+//
+// Layout: the header, the word list index of each answer column in increasing order, then from data_offset one row
+// per guess in word list order, row_stride bytes apart, holding a score byte per answer column. Rows are padded so
+// that each one starts on a MATRIX_ALIGN byte boundary.
+
+#define MATRIX_MAGIC "WLMATRIX"
+#define MATRIX_VERSION 1
+#define MATRIX_ALIGN 64
+
+struct matrix_header {
+    char magic[8];
+    uint16_t version;
+    uint16_t num_guesses;
+    uint16_t num_answers;
+    uint16_t reserved;
+    uint32_t row_stride;
+    uint32_t data_offset;
+    // matrix_checksum of the word and answer lists it was built from, so that a stale file can be detected
+    uint32_t checksum;
+    uint32_t reserved2;
+};
+
+struct matrix {
+    const struct matrix_header *header;
+    const uint16_t *answers;
+    const uint8_t *data;
+    size_t size;
+};
+
+// Checksum of the loaded word list, and of the answers as word list indices
+uint32_t matrix_checksum(const uint16_t *answers, uint16_t num_answers);
+
+// The distinct answers in the loaded ANSWERS appvar, as word list indices in increasing order. Returns the count.
+uint16_t matrix_answers(uint16_t *answers);
+
+// Fills in a header for the loaded word and answer lists
+void matrix_init_header(struct matrix_header *header, const uint16_t *answers, uint16_t num_answers);
+
+// Checks that a file built for these answers and checksum matches the loaded word and answer lists. Returns a
+// message saying what's wrong, or NULL.
+const char *matrix_check_lists(uint16_t num_guesses, const uint16_t *answers, uint16_t count, uint32_t checksum);
+
+// Maps a whole file read-only and shared, printing a message and returning NULL if it can't or the file is smaller
+// than min_size. Used for the other precomputed tables as well.
+void *matrix_map(const char *path, size_t min_size, size_t *size);
+
+// A file being written through a shared mapping, under a temporary name until it's complete
+struct matrix_output {
+    const char *path;
+    char *temp_path;
+    int fd;
+    uint8_t *data;
+    size_t size;
+};
+
+// Creates a file of the given size under a temporary name next to path, and maps it for writing. Prints a message
+// and returns false if it can't. Used for the other precomputed tables as well.
+bool matrix_create(struct matrix_output *output, const char *path, size_t size);
+
+// Syncs and unmaps the file, then renames it into place, so that tools already mapping the old one never see it
+// half written. Prints a message, removes the temporary file and returns false on failure.
+bool matrix_finish(struct matrix_output *output);
+
+// Maps a matrix file, after the word and answer lists are loaded. Prints a message and returns false if it can't be
+// read, or was built from different lists.
+bool matrix_open(struct matrix *matrix, const char *path);
+void matrix_close(struct matrix *matrix);
+
+static inline const uint8_t *matrix_row(const struct matrix *matrix, uint16_t guess) {
+    return matrix->data + (size_t)guess * matrix->header->row_stride;
+}
+
+// Column of an answer, or -1 if the word isn't one
+int32_t matrix_column(const struct matrix *matrix, uint16_t word);
+
+#endif //WORDLE_HOST_MATRIX_H
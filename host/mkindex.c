@@ -0,0 +1,156 @@
+// Writes the inverted feedback index (see invindex.h): for every guess and score, the answers giving that score.
+// Usage: mkindex [-j threads] WORDS.8xv ANSWERS.8xv output
+//
+// Like mkmatrix, the file is written under a temporary name and renamed into place once it's complete.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "appvar.h"
+#include "batch.h"
+#include "game.h"
+#include "invindex.h"
+#include "matrix.h"
+#include "pool.h"
+#include "util.h"
+#include "wordlist.h"
+#include "words.h"
+
+// Guesses per task
+#define TASK_GUESSES 64
+
+struct job {
+    uint16_t num_answers;
+    char (*words)[WORD_LENGTH];
+    struct answer_columns columns;
+    // Scores of one guess, for each worker
+    uint8_t **scores;
+    uint16_t *members;
+    // Cells of each guess before they're packed together, NUM_SCORES apart
+    struct invindex_cell *cells;
+    uint8_t *num_cells;
+};
+
+static void index_guesses(void *ctx, size_t task, unsigned worker) {
+    struct job *job = ctx;
+    uint8_t *scores = job->scores[worker];
+    size_t end = (task + 1) * TASK_GUESSES < num_words ? (task + 1) * TASK_GUESSES : num_words;
+    for(size_t g = task * TASK_GUESSES; g < end; g++) {
+        batch_score(job->words[g], &job->columns, scores);
+
+        // Counting sort by score, which keeps each cell's answers in increasing order
+        uint16_t starts[NUM_SCORES] = {0};
+        for(uint16_t a = 0; a < job->num_answers; a++) {
+            starts[scores[a]]++;
+        }
+        struct invindex_cell *cells = &job->cells[g * NUM_SCORES];
+        uint8_t num_cells = 0;
+        uint16_t start = 0;
+        for(uint16_t s = 0; s < NUM_SCORES; s++) {
+            uint16_t count = starts[s];
+            if(count) {
+                cells[num_cells++] = (struct invindex_cell){.score = s, .start = start};
+            }
+            starts[s] = start;
+            start += count;
+        }
+        job->num_cells[g] = num_cells;
+
+        uint16_t *members = &job->members[g * job->num_answers];
+        for(uint16_t a = 0; a < job->num_answers; a++) {
+            members[starts[scores[a]]++] = a;
+        }
+    }
+}
+
+static uint32_t align(uint32_t offset) {
+    return (offset + MATRIX_ALIGN - 1) / MATRIX_ALIGN * MATRIX_ALIGN;
+}
+
+int main(int argc, char **argv) {
+    unsigned threads = 0;
+    int opt;
+    while((opt = getopt(argc, argv, "j:")) != -1) {
+        switch(opt) {
+            case 'j': threads = strtoul(optarg, NULL, 0); break;
+            default: goto usage;
+        }
+    }
+    if(argc - optind != 3) {
+usage:
+        fprintf(stderr, "usage: %s [-j threads] WORDS.8xv ANSWERS.8xv output\n", argv[0]);
+        return 2;
+    }
+    if(!wordlist_init(load_appvar(argv[optind])) || !answers_init(load_appvar(argv[optind + 1]))) {
+        fprintf(stderr, "unsupported or mismatched appvars\n");
+        return 1;
+    }
+    const char *path = argv[optind + 2];
+
+    uint16_t *answer_indices = malloc(num_answers * sizeof *answer_indices);
+    uint16_t count = matrix_answers(answer_indices);
+
+    struct job job = {.num_answers = count};
+    job.words = malloc((size_t)num_words * WORD_LENGTH);
+    char (*answers)[WORD_LENGTH] = malloc((size_t)count * WORD_LENGTH);
+    for(uint16_t i = 0; i < num_words; i++) {
+        wordlist_get(i, job.words[i]);
+    }
+    for(uint16_t i = 0; i < count; i++) {
+        memcpy(answers[i], job.words[answer_indices[i]], WORD_LENGTH);
+    }
+    columns_init(&job.columns, answers, count);
+    job.members = malloc((size_t)num_words * count * sizeof *job.members);
+    job.cells = malloc((size_t)num_words * NUM_SCORES * sizeof *job.cells);
+    job.num_cells = malloc(num_words);
+
+    struct pool *pool = pool_create(threads);
+    job.scores = malloc(pool_threads(pool) * sizeof *job.scores);
+    for(unsigned i = 0; i < pool_threads(pool); i++) {
+        job.scores[i] = aligned_alloc(BATCH_LANES, job.columns.stride);
+    }
+    double start = now();
+    pool_run(pool, (num_words + TASK_GUESSES - 1) / TASK_GUESSES, index_guesses, &job);
+    double elapsed = now() - start;
+    threads = pool_threads(pool);
+    pool_destroy(pool);
+
+    struct invindex_header header = {
+            .magic = INVINDEX_MAGIC,
+            .version = INVINDEX_VERSION,
+            .num_guesses = num_words,
+            .num_answers = count,
+            .checksum = matrix_checksum(answer_indices, count),
+    };
+    for(uint16_t g = 0; g < num_words; g++) {
+        header.num_cells += job.num_cells[g];
+    }
+    header.guesses_offset = align(sizeof header + count * sizeof *answer_indices);
+    header.cells_offset = align(header.guesses_offset + (num_words + 1) * sizeof(uint32_t));
+    header.members_offset = align(header.cells_offset + header.num_cells * sizeof(struct invindex_cell));
+    size_t size = header.members_offset + (size_t)num_words * count * sizeof *job.members;
+
+    struct matrix_output output;
+    if(!matrix_create(&output, path, size)) return 1;
+    uint8_t *map = output.data;
+    memcpy(map, &header, sizeof header);
+    memcpy(map + sizeof header, answer_indices, count * sizeof *answer_indices);
+    uint32_t *guesses = (uint32_t*)(map + header.guesses_offset);
+    struct invindex_cell *cells = (struct invindex_cell*)(map + header.cells_offset);
+    uint32_t cell = 0;
+    for(uint16_t g = 0; g < num_words; g++) {
+        guesses[g] = cell;
+        memcpy(&cells[cell], &job.cells[g * NUM_SCORES], job.num_cells[g] * sizeof *cells);
+        cell += job.num_cells[g];
+    }
+    guesses[num_words] = cell;
+    memcpy(map + header.members_offset, job.members, (size_t)num_words * count * sizeof *job.members);
+
+    if(!matrix_finish(&output)) return 1;
+    printf("%s: %u guesses by %u answers, %u nonempty cells of %u, %zu bytes, built on %u threads in %.3f s\n",
+           path, header.num_guesses, header.num_answers, header.num_cells, (uint32_t)num_words * NUM_SCORES, size,
+           threads, elapsed);
+    return 0;
+}
@@ -0,0 +1,98 @@
+// Writes the feedback matrix (see matrix.h): score_guess for every word against every distinct answer.
+// Usage: mkmatrix [-j threads] WORDS.8xv ANSWERS.8xv output
+//
+// The file is written under a temporary name and renamed into place once it's complete, so that tools already
+// mapping the old one are never left with a half written matrix.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "appvar.h"
+#include "batch.h"
+#include "game.h"
+#include "matrix.h"
+#include "pool.h"
+#include "util.h"
+#include "wordlist.h"
+#include "words.h"
+
+// Rows per task
+#define TASK_ROWS 64
+
+struct job {
+    const struct matrix_header *header;
+    char (*words)[WORD_LENGTH];
+    struct answer_columns columns;
+    uint8_t *data;
+};
+
+static void fill_rows(void *ctx, size_t task, unsigned worker) {
+    (void)worker;
+    struct job *job = ctx;
+    size_t end = (task + 1) * TASK_ROWS < job->header->num_guesses ? (task + 1) * TASK_ROWS : job->header->num_guesses;
+    for(size_t g = task * TASK_ROWS; g < end; g++) {
+        // The row stride is a multiple of the batch's, so it can write straight into the row
+        uint8_t *row = job->data + g * job->header->row_stride;
+        batch_score(job->words[g], &job->columns, row);
+        memset(row + job->header->num_answers, 0, job->header->row_stride - job->header->num_answers);
+    }
+}
+
+int main(int argc, char **argv) {
+    unsigned threads = 0;
+    int opt;
+    while((opt = getopt(argc, argv, "j:")) != -1) {
+        switch(opt) {
+            case 'j': threads = strtoul(optarg, NULL, 0); break;
+            default: goto usage;
+        }
+    }
+    if(argc - optind != 3) {
+usage:
+        fprintf(stderr, "usage: %s [-j threads] WORDS.8xv ANSWERS.8xv output\n", argv[0]);
+        return 2;
+    }
+    if(!wordlist_init(load_appvar(argv[optind])) || !answers_init(load_appvar(argv[optind + 1]))) {
+        fprintf(stderr, "unsupported or mismatched appvars\n");
+        return 1;
+    }
+    const char *path = argv[optind + 2];
+
+    uint16_t *answer_indices = malloc(num_answers * sizeof *answer_indices);
+    uint16_t count = matrix_answers(answer_indices);
+    struct matrix_header header;
+    matrix_init_header(&header, answer_indices, count);
+    size_t size = header.data_offset + (size_t)header.num_guesses * header.row_stride;
+
+    struct job job = {.header = &header};
+    job.words = malloc((size_t)num_words * WORD_LENGTH);
+    char (*answers)[WORD_LENGTH] = malloc((size_t)count * WORD_LENGTH);
+    for(uint16_t i = 0; i < num_words; i++) {
+        wordlist_get(i, job.words[i]);
+    }
+    for(uint16_t i = 0; i < count; i++) {
+        memcpy(answers[i], job.words[answer_indices[i]], WORD_LENGTH);
+    }
+    columns_init(&job.columns, answers, count);
+
+    struct matrix_output output;
+    if(!matrix_create(&output, path, size)) return 1;
+    uint8_t *map = output.data;
+    memcpy(map, &header, sizeof header);
+    memcpy(map + sizeof header, answer_indices, count * sizeof *answer_indices);
+    job.data = map + header.data_offset;
+
+    struct pool *pool = pool_create(threads);
+    double start = now();
+    pool_run(pool, (header.num_guesses + TASK_ROWS - 1) / TASK_ROWS, fill_rows, &job);
+    double elapsed = now() - start;
+    threads = pool_threads(pool);
+    pool_destroy(pool);
+
+    if(!matrix_finish(&output)) return 1;
+    printf("%s: %u guesses by %u answers, %zu bytes, built with %s on %u threads in %.3f s\n", path,
+           header.num_guesses, header.num_answers, size, batch_name(batch_best()), threads, elapsed);
+    return 0;
+}
@@ -0,0 +1,769 @@
+// Finds the decision tree that solves every answer in the fewest guesses in total, and writes it as a HINTS appvar
+// (see src/hint.h) in place of the greedy one from tools/mkhints.py.
+// Usage: optimal [-j threads] [-H] [-a] [-k count] [-o OPENER] [-t MiB] [-c checkpoint] [-d depths]
+//                WORDS.8xv ANSWERS.8xv feedback.matrix HINTS.8xv
+//
+// The search is a depth first branch and bound over the answers that are left, as a bitset of matrix columns. Each
+// set's cost is bounded below by how many answers could at best be solved with one and two more guesses, guesses
+// whose bounds can't beat the best found so far are skipped, and results are kept in a table keyed by a hash of the
+// set, so that the many orders of guesses that lead to the same set only search it once.
+//
+// -H only makes guesses that hard mode would accept, so that the tree can be followed in either mode. -a only tries
+// answers as guesses, and -k only the count most promising guesses at each step, by their bounds. Either makes the
+// result no longer a true optimum, but finishes far sooner. -o fixes the first guess, and -t sets the size of the
+// table. -d writes the number of guesses each answer takes, for rating how hard each one is.
+//
+// The first guesses are shared out across threads, or the sets left after the opener with -o. With -c, each one is
+// appended to a checkpoint file as it finishes, along with the guesses its part of the tree makes, and runs with the
+// same options and lists skip the ones already there and build the tree straight from what was saved.
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "answerset.h"
+#include "appvar.h"
+#include "constraints.h"
+#include "game.h"
+#include "hint.h"
+#include "matrix.h"
+#include "pool.h"
+#include "util.h"
+#include "wordlist.h"
+#include "words.h"
+
+#define COST_INFINITE 0xffff
+#define CHECKPOINT_VERSION 2
+
+// A guess to try from some set, with what's known about it before searching any further
+struct option {
+    uint16_t guess;
+    uint32_t bound;
+    // Sum of the squares of the bucket sizes, to break ties in favour of more even splits
+    uint32_t spread;
+};
+
+// Scratch space for one level of the search
+struct level {
+    struct option *options;
+    uint16_t *members;
+    struct answer_set parts[NUM_SCORES];
+    uint8_t scores[NUM_SCORES];
+};
+
+struct worker {
+    struct level levels[MAX_GUESSES + 1];
+    uint16_t counts[NUM_SCORES];
+};
+
+// Guesses in the order emit makes them, one for each node below the root of a task
+struct plan {
+    uint16_t *guesses;
+    size_t size;
+    size_t capacity;
+};
+
+// Result of one of the tasks shared out between threads
+struct result {
+    bool done;
+    bool exact;
+    // The exact cost, or a lower bound on it that is no better than the best found
+    uint32_t cost;
+    // How to reach the exact cost, empty otherwise
+    struct plan plan;
+};
+
+static struct matrix matrix;
+static char (*words)[WORD_LENGTH];
+// Word list index of each matrix column
+static const uint16_t *column_words;
+static uint16_t num_columns;
+
+static bool hard;
+static bool answers_only;
+static uint16_t max_options;
+
+// Lower bound on the cost of a set of size n with some guesses left, by [left][n]
+static uint32_t *bounds;
+
+// Transposition table. Each entry is stored as its data and its key xored with its data, so that an entry torn by
+// two threads writing at once fails the key check instead of being misread.
+struct table_entry {
+    uint64_t check;
+    uint64_t data;
+};
+
+#define ENTRY_EXACT ((uint64_t)1 << 32)
+
+static struct table_entry *table;
+static uint64_t table_mask;
+
+static struct worker *workers;
+
+static uint32_t lower_bound(uint16_t n, uint8_t left) {
+    return bounds[left * (num_columns + 1) + n];
+}
+
+static void init_bounds(void) {
+    bounds = malloc((MAX_GUESSES + 1) * (num_columns + 1) * sizeof *bounds);
+    for(uint8_t left = 0; left <= MAX_GUESSES; left++) {
+        for(uint32_t n = 0; n <= num_columns; n++) {
+            uint32_t bound;
+            if(n <= 1) {
+                bound = n;
+            } else if(left <= 1) {
+                bound = COST_INFINITE;
+            } else if(left == 2 && n > NUM_SCORES) {
+                // The second guess can only be right for one answer in each bucket
+                bound = COST_INFINITE;
+            } else {
+                // At best one answer is guessed straight away, one from each other bucket next, and the rest after
+                uint32_t second = n - 1 < NUM_SCORES - 1 ? n - 1 : NUM_SCORES - 1;
+                bound = 1 + 2 * second + 3 * (n - 1 - second);
+            }
+            bounds[left * (num_columns + 1) + n] = bound;
+        }
+    }
+}
+
+static uint64_t mix(uint64_t x) {
+    // splitmix64's finalizer
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111eb;
+    return x ^ x >> 31;
+}
+
+static uint64_t hash_state(const struct answer_set *set, const struct constraints *constraints, uint8_t left) {
+    uint64_t hash = mix(left);
+    for(uint8_t w = 0; w < ANSWER_SET_WORDS; w++) {
+        hash = mix(hash ^ set->words[w]);
+    }
+    if(constraints) {
+        // Only the rules that decide which guesses are allowed, which don't depend on the order rows were played in
+        for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+            hash = mix(hash ^ (uint8_t)constraints->fixed[i]);
+        }
+        for(uint8_t i = 0; i < 26; i++) {
+            if(constraints->min_count[i]) hash = mix(hash ^ ((uint64_t)i << 8 | constraints->min_count[i]));
+        }
+    }
+    return hash;
+}
+
+static bool table_get(uint64_t key, uint32_t *cost, uint16_t *guess, bool *exact) {
+    struct table_entry *entry = &table[key & table_mask];
+    uint64_t data = __atomic_load_n(&entry->data, __ATOMIC_RELAXED);
+    uint64_t check = __atomic_load_n(&entry->check, __ATOMIC_RELAXED);
+    if((check ^ data) != key) return false;
+    *cost = data & 0xffff;
+    *guess = data >> 16 & 0xffff;
+    *exact = data & ENTRY_EXACT;
+    return true;
+}
+
+static void table_put(uint64_t key, uint32_t cost, uint16_t guess, bool exact) {
+    struct table_entry *entry = &table[key & table_mask];
+    uint64_t data = (cost < COST_INFINITE ? cost : COST_INFINITE) | (uint64_t)guess << 16 | (exact ? ENTRY_EXACT : 0);
+    __atomic_store_n(&entry->data, data, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->check, key ^ data, __ATOMIC_RELAXED);
+}
+
+static int compare_options(const void *a, const void *b) {
+    const struct option *x = a;
+    const struct option *y = b;
+    if(x->bound != y->bound) return x->bound < y->bound ? -1 : 1;
+    if(x->spread != y->spread) return x->spread < y->spread ? -1 : 1;
+    return x->guess - y->guess;
+}
+
+// Fills in the level's options for a set, best first, and returns how many there are. Guesses that don't split the
+// set at all are left out.
+static uint16_t list_options(struct worker *worker, struct level *level, const struct answer_set *set, uint16_t n,
+                             const struct constraints *constraints, uint8_t left) {
+    uint16_t num_members = set_members(set, level->members);
+    uint16_t *counts = worker->counts;
+    uint16_t num_options = 0;
+    uint16_t num_guesses = answers_only ? num_columns : num_words;
+    for(uint16_t i = 0; i < num_guesses; i++) {
+        uint16_t guess = answers_only ? column_words[i] : i;
+        if(constraints && !constraints_allow(constraints, words[guess])) continue;
+        const uint8_t *row = matrix_row(&matrix, guess);
+        uint8_t used[NUM_SCORES];
+        uint16_t num_used = 0;
+        for(uint16_t m = 0; m < num_members; m++) {
+            uint8_t score = row[level->members[m]];
+            if(!counts[score]++) used[num_used++] = score;
+        }
+        struct option option = {.guess = guess, .bound = n, .spread = 0};
+        for(uint16_t u = 0; u < num_used; u++) {
+            uint16_t count = counts[used[u]];
+            if(used[u] != SCORE_CORRECT) option.bound += lower_bound(count, left - 1);
+            option.spread += (uint32_t)count * count;
+            counts[used[u]] = 0;
+        }
+        if(num_used == 1 && used[0] != SCORE_CORRECT) continue;
+        if(option.bound >= COST_INFINITE) continue;
+        level->options[num_options++] = option;
+    }
+    qsort(level->options, num_options, sizeof *level->options, compare_options);
+    if(max_options && num_options > max_options) num_options = max_options;
+    return num_options;
+}
+
+static uint32_t search(struct worker *worker, const struct answer_set *set, uint16_t n,
+                       const struct constraints *constraints, uint8_t left, uint32_t limit, uint16_t *guess);
+
+// Cost of a set when starting with a guess: one guess for every answer, plus the cost of each bucket it leaves.
+// Gives up once the total can't be under *limit, which may be lowered by other threads while it runs, returning a
+// lower bound at least as large.
+static uint32_t try_guess(struct worker *worker, struct level *level, const struct answer_set *set, uint16_t n,
+                          const struct constraints *constraints, uint8_t left, const struct option *option,
+                          const uint32_t *limit) {
+    uint8_t num_scores = set_partition(set, matrix_row(&matrix, option->guess), level->parts, level->scores);
+    uint32_t cost = n;
+    // Lower bounds of the buckets not searched yet
+    uint32_t rest = option->bound - n;
+    for(uint8_t i = 0; i < num_scores; i++) {
+        uint8_t score = level->scores[i];
+        if(score == SCORE_CORRECT) continue;
+        const struct answer_set *part = &level->parts[score];
+        uint16_t count = set_count(part);
+        rest -= lower_bound(count, left - 1);
+
+        struct constraints next;
+        if(constraints) {
+            enum tile_type tiles[WORD_LENGTH];
+            next = *constraints;
+            decode_score(score, tiles);
+            constraints_add(&next, words[option->guess], tiles);
+        }
+        uint32_t max = __atomic_load_n(limit, __ATOMIC_RELAXED);
+        if(cost + rest >= max) return cost + rest + lower_bound(count, left - 1);
+        uint16_t ignored;
+        cost += search(worker, part, count, constraints ? &next : NULL, left - 1, max - cost - rest, &ignored);
+    }
+    return cost + rest;
+}
+
+// Lowest total number of guesses to solve every answer in a set, with some guesses left, and the guess to start
+// with. If it can't be done for less than limit, returns a lower bound that is at least limit instead.
+static uint32_t search(struct worker *worker, const struct answer_set *set, uint16_t n,
+                       const struct constraints *constraints, uint8_t left, uint32_t limit, uint16_t *guess) {
+    if(n == 1 || (n == 2 && left >= 2)) {
+        // Guess one of them, and if it's wrong then the other
+        *guess = column_words[set_next(set, 0)];
+        return 2 * n - 1;
+    }
+    uint32_t bound = lower_bound(n, left);
+    if(bound >= limit) return bound;
+
+    uint64_t key = hash_state(set, constraints, left);
+    uint32_t known;
+    bool exact;
+    if(table_get(key, &known, guess, &exact)) {
+        if(exact || known >= limit) return known;
+        if(known > bound) bound = known;
+    }
+
+    struct level *level = &worker->levels[MAX_GUESSES - left];
+    uint16_t num_options = list_options(worker, level, set, n, constraints, left);
+    uint32_t best = limit;
+    for(uint16_t i = 0; i < num_options && best > bound; i++) {
+        const struct option *option = &level->options[i];
+        // Options are sorted by bound, so none of the rest can do better either
+        if(option->bound >= best) break;
+        uint32_t cost = try_guess(worker, level, set, n, constraints, left, option, &best);
+        if(cost < best) {
+            best = cost;
+            *guess = option->guess;
+        }
+    }
+
+    table_put(key, best, *guess, best < limit);
+    return best;
+}
+
+static void plan_push(struct plan *plan, uint16_t guess) {
+    if(plan->size == plan->capacity) {
+        plan->capacity = plan->capacity ? plan->capacity * 2 : 64;
+        plan->guesses = realloc(plan->guesses, plan->capacity * sizeof *plan->guesses);
+    }
+    plan->guesses[plan->size++] = guess;
+}
+
+static void plan_children(struct worker *worker, struct plan *plan, const struct answer_set *set,
+                          const struct constraints *constraints, uint8_t left, uint16_t guess);
+
+// Appends the guesses for a set and the sets below it. One answer needs no node, since emit makes it a leaf.
+static void plan_set(struct worker *worker, struct plan *plan, const struct answer_set *set, uint16_t n,
+                     const struct constraints *constraints, uint8_t left) {
+    if(n < 2) return;
+    uint16_t guess;
+    // Mostly answered by the table, since the task has just searched the same sets
+    search(worker, set, n, constraints, left, COST_INFINITE, &guess);
+    plan_push(plan, guess);
+    plan_children(worker, plan, set, constraints, left, guess);
+}
+
+// Appends the guesses for each set a guess leaves, in the order of their scores
+static void plan_children(struct worker *worker, struct plan *plan, const struct answer_set *set,
+                          const struct constraints *constraints, uint8_t left, uint16_t guess) {
+    struct answer_set *parts = malloc(NUM_SCORES * sizeof *parts);
+    uint8_t scores[NUM_SCORES];
+    uint8_t num_scores = set_partition(set, matrix_row(&matrix, guess), parts, scores);
+    for(uint8_t i = 0; i < num_scores; i++) {
+        if(scores[i] == SCORE_CORRECT) continue;
+        struct constraints next;
+        if(constraints) {
+            enum tile_type tiles[WORD_LENGTH];
+            next = *constraints;
+            decode_score(scores[i], tiles);
+            constraints_add(&next, words[guess], tiles);
+        }
+        plan_set(worker, plan, &parts[scores[i]], set_count(&parts[scores[i]]), constraints ? &next : NULL, left - 1);
+    }
+    free(parts);
+}
+
+// The tasks shared out between threads: either first guesses, or the sets the opener leaves
+struct job {
+    struct answer_set all;
+    const struct constraints *constraints;
+    struct option *options;
+    // Sets left after the opener
+    struct answer_set *parts;
+    uint8_t *scores;
+    // Best total found for any first guess, and one more than it, which first guesses are searched up to. Ties are
+    // worked out exactly, so that the tree is the same however the work was split up. With an opener, best is the
+    // total so far instead.
+    uint32_t best;
+    uint32_t limit;
+    bool by_score;
+    struct result *results;
+    size_t num_tasks;
+    size_t finished;
+    FILE *checkpoint;
+    pthread_mutex_t lock;
+};
+
+static void finish_task(struct job *job, size_t task, uint32_t key, uint32_t cost, bool exact, struct plan plan) {
+    pthread_mutex_lock(&job->lock);
+    job->results[task] = (struct result){.done = true, .exact = exact, .cost = cost, .plan = plan};
+    job->finished++;
+    if(job->by_score) {
+        job->best += cost;
+    } else if(exact && cost < job->best) {
+        job->best = cost;
+        __atomic_store_n(&job->limit, cost + 1, __ATOMIC_RELAXED);
+    }
+    if(job->checkpoint) {
+        fprintf(job->checkpoint, "%u %u %u %zu", key, cost, exact, plan.size);
+        for(size_t i = 0; i < plan.size; i++) {
+            fprintf(job->checkpoint, " %u", plan.guesses[i]);
+        }
+        fputc('\n', job->checkpoint);
+        fflush(job->checkpoint);
+    }
+    fprintf(stderr, "\r%zu/%zu done, %s %u ", job->finished, job->num_tasks, job->by_score ? "total" : "best",
+            job->best);
+    pthread_mutex_unlock(&job->lock);
+}
+
+static void try_first_guess(void *ctx, size_t task, unsigned worker_index) {
+    struct job *job = ctx;
+    if(job->results[task].done) return;
+    struct worker *worker = &workers[worker_index];
+    const struct option *option = &job->options[task];
+    uint32_t cost = option->bound;
+    if(cost < __atomic_load_n(&job->limit, __ATOMIC_RELAXED)) {
+        cost = try_guess(worker, &worker->levels[0], &job->all, num_columns, job->constraints, MAX_GUESSES, option,
+                         &job->limit);
+    }
+    // If it gave up, it did so at a limit at least as high as the current one
+    bool exact = cost < __atomic_load_n(&job->limit, __ATOMIC_RELAXED);
+    struct plan plan = {0};
+    if(exact) plan_children(worker, &plan, &job->all, job->constraints, MAX_GUESSES, option->guess);
+    finish_task(job, task, option->guess, cost, exact, plan);
+}
+
+static void solve_part(void *ctx, size_t task, unsigned worker_index) {
+    struct job *job = ctx;
+    if(job->results[task].done) return;
+    const struct answer_set *part = &job->parts[job->scores[task]];
+    struct constraints next;
+    if(job->constraints) {
+        enum tile_type tiles[WORD_LENGTH];
+        next = *job->constraints;
+        decode_score(job->scores[task], tiles);
+        constraints_add(&next, words[job->options[0].guess], tiles);
+    }
+    struct worker *worker = &workers[worker_index];
+    uint16_t n = set_count(part);
+    uint16_t guess;
+    uint32_t cost = search(worker, part, n, job->constraints ? &next : NULL, MAX_GUESSES - 1, COST_INFINITE, &guess);
+    struct plan plan = {0};
+    plan_set(worker, &plan, part, n, job->constraints ? &next : NULL, MAX_GUESSES - 1);
+    finish_task(job, task, job->scores[task], cost, true, plan);
+}
+
+struct tree {
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+    // Guesses each answer takes, by column
+    uint8_t *depths;
+    uint16_t nodes;
+    // Guesses to make below the root, and how many have been used
+    const struct plan *plan;
+    size_t planned;
+    const char *error;
+};
+
+static size_t tree_reserve(struct tree *tree, size_t size) {
+    size_t offset = tree->size;
+    tree->size += size;
+    if(tree->size > tree->capacity) {
+        tree->capacity = tree->size * 2;
+        tree->data = realloc(tree->data, tree->capacity);
+    }
+    return offset;
+}
+
+static void write_u16(uint8_t *ptr, uint16_t value) {
+    ptr[0] = value;
+    ptr[1] = value >> 8;
+}
+
+// Writes the node for a set and its guess, then the nodes below it with the guesses from the plan. Returns the node's
+// offset, or -1 with tree->error set if the plan doesn't fit the sets or the tree has grown too large to address.
+static int32_t emit(struct tree *tree, const struct answer_set *set, const struct constraints *constraints,
+                    uint8_t left, uint16_t guess, uint8_t depth) {
+    if(!left) {
+        tree->error = "plan runs out of guesses";
+        return -1;
+    }
+    struct answer_set *parts = malloc(NUM_SCORES * sizeof *parts);
+    uint8_t scores[NUM_SCORES];
+    uint8_t num_scores = set_partition(set, matrix_row(&matrix, guess), parts, scores);
+    uint8_t num_children = num_scores;
+    int32_t column = matrix_column(&matrix, guess);
+    if(column >= 0 && set_has(set, column)) {
+        tree->depths[column] = depth;
+        num_children--;
+    }
+
+    size_t offset = tree_reserve(tree, 3 + 3 * num_children);
+    tree->nodes++;
+    write_u16(&tree->data[offset], guess);
+    tree->data[offset + 2] = num_children;
+    uint8_t child = 0;
+    for(uint8_t i = 0; i < num_scores; i++) {
+        uint8_t score = scores[i];
+        if(score == SCORE_CORRECT) continue;
+        const struct answer_set *part = &parts[score];
+        uint16_t count = set_count(part);
+        int32_t value;
+        if(count == 1) {
+            uint16_t last = set_next(part, 0);
+            tree->depths[last] = depth + 1;
+            value = HINTS_LEAF | column_words[last];
+        } else {
+            struct constraints next;
+            if(constraints) {
+                enum tile_type tiles[WORD_LENGTH];
+                next = *constraints;
+                decode_score(score, tiles);
+                constraints_add(&next, words[guess], tiles);
+            }
+            if(tree->planned == tree->plan->size) {
+                tree->error = "plan is too short";
+                free(parts);
+                return -1;
+            }
+            uint16_t next_guess = tree->plan->guesses[tree->planned++];
+            value = emit(tree, part, constraints ? &next : NULL, left - 1, next_guess, depth + 1);
+            if(value < 0) {
+                free(parts);
+                return -1;
+            }
+        }
+        // The data may have moved while writing the children
+        uint8_t *entry = &tree->data[offset + 3 + 3 * child++];
+        entry[0] = score;
+        write_u16(entry + 1, value);
+    }
+    free(parts);
+    if(offset >= HINTS_LEAF) {
+        tree->error = "tree is too large to address";
+        return -1;
+    }
+    return offset;
+}
+
+// Reads one task's line: its key, cost, whether the cost is exact, and its plan. Returns false if it's malformed.
+static bool parse_result(char *line, uint32_t *key, struct result *result) {
+    char *end;
+    unsigned long values[4];
+    for(uint8_t i = 0; i < 4; i++) {
+        values[i] = strtoul(line, &end, 10);
+        if(end == line) return false;
+        line = end;
+    }
+    *key = values[0];
+    *result = (struct result){.done = true, .exact = values[2], .cost = values[1]};
+    for(unsigned long i = 0; i < values[3]; i++) {
+        unsigned long guess = strtoul(line, &end, 10);
+        if(end == line || guess >= num_words) {
+            free(result->plan.guesses);
+            return false;
+        }
+        plan_push(&result->plan, guess);
+        line = end;
+    }
+    return *line == '\n';
+}
+
+// Returns false if the file is from a run with different options. Sets *started if it has a header at all, and
+// *torn if the last line was cut short by an interrupted run, in which case that task is searched again.
+static bool read_checkpoint(FILE *f, const char *expected, struct job *job, bool *started, bool *torn) {
+    char *line = NULL;
+    size_t capacity = 0;
+    if(getline(&line, &capacity, f) < 0) {
+        free(line);
+        return true;
+    }
+    if(strcmp(line, expected) != 0) {
+        free(line);
+        return false;
+    }
+    *started = true;
+    while(getline(&line, &capacity, f) >= 0) {
+        uint32_t key;
+        struct result result;
+        *torn = !parse_result(line, &key, &result);
+        if(*torn) continue;
+        for(size_t task = 0; task < job->num_tasks; task++) {
+            if((job->by_score ? job->scores[task] : job->options[task].guess) != key) continue;
+            job->results[task] = result;
+            job->finished++;
+            if(job->by_score) {
+                job->best += result.cost;
+            } else if(result.exact && result.cost < job->best) {
+                job->best = result.cost;
+                job->limit = result.cost + 1;
+            }
+        }
+    }
+    free(line);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    unsigned threads = 0;
+    const char *opener_word = NULL;
+    const char *checkpoint_path = NULL;
+    const char *depths_path = NULL;
+    size_t table_mib = 512;
+    int opt;
+    while((opt = getopt(argc, argv, "j:Hak:o:t:c:d:")) != -1) {
+        switch(opt) {
+            case 'j': threads = strtoul(optarg, NULL, 0); break;
+            case 'H': hard = true; break;
+            case 'a': answers_only = true; break;
+            case 'k': max_options = strtoul(optarg, NULL, 0); break;
+            case 'o': opener_word = optarg; break;
+            case 't': table_mib = strtoul(optarg, NULL, 0); break;
+            case 'c': checkpoint_path = optarg; break;
+            case 'd': depths_path = optarg; break;
+            default: goto usage;
+        }
+    }
+    if(argc - optind != 4 || !table_mib) {
+usage:
+        fprintf(stderr, "usage: %s [-j threads] [-H] [-a] [-k count] [-o OPENER] [-t MiB] [-c checkpoint] "
+                        "[-d depths] WORDS.8xv ANSWERS.8xv feedback.matrix HINTS.8xv\n", argv[0]);
+        return 2;
+    }
+    if(!wordlist_init(load_appvar(argv[optind])) || !answers_init(load_appvar(argv[optind + 1]))) {
+        fprintf(stderr, "unsupported or mismatched appvars\n");
+        return 1;
+    }
+    if(!matrix_open(&matrix, argv[optind + 2])) return 1;
+    const char *output_path = argv[optind + 3];
+    column_words = matrix.answers;
+    num_columns = matrix.header->num_answers;
+    if(num_columns > MAX_SET_ANSWERS) {
+        fprintf(stderr, "more than %u answers\n", MAX_SET_ANSWERS);
+        return 1;
+    }
+
+    words = malloc((size_t)num_words * WORD_LENGTH);
+    for(uint16_t i = 0; i < num_words; i++) {
+        wordlist_get(i, words[i]);
+    }
+    int32_t opener = -1;
+    if(opener_word) {
+        char upper[WORD_LENGTH] = {0};
+        for(uint8_t i = 0; i < WORD_LENGTH && opener_word[i]; i++) upper[i] = opener_word[i] & ~0x20;
+        uint16_t found;
+        uint16_t index = wordlist_prefix(upper, WORD_LENGTH, &found);
+        if(strlen(opener_word) != WORD_LENGTH || !found) {
+            fprintf(stderr, "%s is not in the word list\n", opener_word);
+            return 2;
+        }
+        opener = index;
+    }
+
+    init_bounds();
+    size_t entries = 1;
+    while(entries * 2 * sizeof *table <= table_mib << 20) entries *= 2;
+    table = calloc(entries, sizeof *table);
+    table_mask = entries - 1;
+
+    struct pool *pool = pool_create(threads);
+    threads = pool_threads(pool);
+    workers = malloc(threads * sizeof *workers);
+    for(unsigned i = 0; i < threads; i++) {
+        for(uint8_t l = 0; l <= MAX_GUESSES; l++) {
+            workers[i].levels[l].options = malloc((size_t)num_words * sizeof(struct option));
+            workers[i].levels[l].members = malloc(num_columns * sizeof(uint16_t));
+        }
+        memset(workers[i].counts, 0, sizeof workers[i].counts);
+    }
+
+    struct constraints constraints;
+    constraints_init(&constraints);
+    struct job job = {.constraints = hard ? &constraints : NULL, .best = COST_INFINITE, .limit = COST_INFINITE};
+    pthread_mutex_init(&job.lock, NULL);
+    set_fill(&job.all, num_columns);
+    if(opener >= 0) {
+        job.by_score = true;
+        job.best = num_columns;
+        job.options = malloc(sizeof *job.options);
+        job.options[0] = (struct option){.guess = opener};
+        job.parts = malloc(NUM_SCORES * sizeof *job.parts);
+        job.scores = malloc(NUM_SCORES);
+        uint8_t num_scores = set_partition(&job.all, matrix_row(&matrix, opener), job.parts, job.scores);
+        for(uint8_t i = 0; i < num_scores; i++) {
+            if(job.scores[i] != SCORE_CORRECT) job.scores[job.num_tasks++] = job.scores[i];
+        }
+    } else {
+        job.num_tasks = list_options(&workers[0], &workers[0].levels[0], &job.all, num_columns, job.constraints,
+                                     MAX_GUESSES);
+        job.options = malloc(job.num_tasks * sizeof *job.options);
+        memcpy(job.options, workers[0].levels[0].options, job.num_tasks * sizeof *job.options);
+    }
+    job.results = calloc(job.num_tasks, sizeof *job.results);
+
+    char header[128];
+    snprintf(header, sizeof header, "optimal %u %08x %u %u %u %d\n", CHECKPOINT_VERSION, matrix.header->checksum, hard,
+             answers_only, max_options, opener);
+    if(checkpoint_path) {
+        bool started = false;
+        bool torn = false;
+        FILE *f = fopen(checkpoint_path, "r");
+        if(f) {
+            bool matches = read_checkpoint(f, header, &job, &started, &torn);
+            fclose(f);
+            if(!matches) {
+                fprintf(stderr, "%s: from a run with different options or lists\n", checkpoint_path);
+                return 1;
+            }
+            if(job.finished) fprintf(stderr, "resuming with %zu of %zu done\n", job.finished, job.num_tasks);
+        }
+        job.checkpoint = fopen(checkpoint_path, "a");
+        if(!job.checkpoint) {
+            perror(checkpoint_path);
+            return 1;
+        }
+        if(!started) fputs(header, job.checkpoint);
+        // Keeps the torn line from running into the next one
+        if(torn) fputc('\n', job.checkpoint);
+    }
+
+    double start = now();
+    pool_run(pool, job.num_tasks, opener >= 0 ? solve_part : try_first_guess, &job);
+    double elapsed = now() - start;
+    pool_destroy(pool);
+    fprintf(stderr, "\n");
+    if(job.checkpoint) fclose(job.checkpoint);
+
+    uint32_t total;
+    uint16_t root;
+    if(opener >= 0) {
+        root = opener;
+        total = num_columns;
+        for(size_t i = 0; i < job.num_tasks; i++) total += job.results[i].cost;
+    } else {
+        total = COST_INFINITE;
+        root = 0;
+        for(size_t i = 0; i < job.num_tasks; i++) {
+            if(job.results[i].exact && job.results[i].cost < total) {
+                total = job.results[i].cost;
+                root = job.options[i].guess;
+            }
+        }
+    }
+    if(total >= COST_INFINITE) {
+        fprintf(stderr, "no tree solves every answer in %u guesses\n", MAX_GUESSES);
+        return 1;
+    }
+
+    // The opener's plan is each of its sets' plans in turn, in the same order of scores as emit goes through them
+    struct plan plan = {0};
+    for(size_t i = 0; i < job.num_tasks; i++) {
+        if(opener < 0 && job.options[i].guess != root) continue;
+        for(size_t g = 0; g < job.results[i].plan.size; g++) {
+            plan_push(&plan, job.results[i].plan.guesses[g]);
+        }
+    }
+    struct tree tree = {.depths = calloc(num_columns, 1), .plan = &plan};
+    struct hints_header hints = {.magic = HINTS_MAGIC, .version = HINTS_VERSION, .num_words = num_words};
+    if(emit(&tree, &job.all, job.constraints, MAX_GUESSES, root, 1) < 0) {
+        fprintf(stderr, "%s\n", tree.error);
+        return 1;
+    }
+    if(tree.planned != plan.size) {
+        fprintf(stderr, "plan is too long\n");
+        return 1;
+    }
+
+    uint32_t check = 0;
+    uint8_t max_depth = 0;
+    for(uint16_t i = 0; i < num_columns; i++) {
+        check += tree.depths[i];
+        if(tree.depths[i] > max_depth) max_depth = tree.depths[i];
+    }
+    if(check != total) {
+        fprintf(stderr, "tree takes %u guesses, not %u\n", check, total);
+        return 1;
+    }
+
+    uint8_t *contents = malloc(sizeof hints + tree.size);
+    memcpy(contents, &hints, sizeof hints);
+    memcpy(contents + sizeof hints, tree.data, tree.size);
+    if(!save_appvar(output_path, "HINTS", contents, sizeof hints + tree.size)) {
+        perror(output_path);
+        return 1;
+    }
+    if(depths_path) {
+        FILE *f = fopen(depths_path, "w");
+        if(!f) {
+            perror(depths_path);
+            return 1;
+        }
+        for(uint16_t i = 0; i < num_columns; i++) {
+            fprintf(f, "%.5s %u\n", words[column_words[i]], tree.depths[i]);
+        }
+        fclose(f);
+    }
+
+    printf("%s: %u nodes, opening with %.5s, %u guesses in total, %.4f on average, at most %u, %zu bytes, "
+           "searched on %u threads in %.1f s\n", output_path, tree.nodes, words[root], total,
+           (double)total / num_columns, max_depth, sizeof hints + tree.size, threads, elapsed);
+    return 0;
+}
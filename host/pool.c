@@ -0,0 +1,172 @@
+#include "pool.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Tasks a worker still has to run, as a range. The owner takes from the front, and thieves take the back half.
+struct range {
+    pthread_mutex_t lock;
+    size_t begin;
+    size_t end;
+};
+
+struct worker {
+    struct pool *pool;
+    unsigned index;
+    pthread_t thread;
+    struct range range;
+};
+
+struct pool {
+    unsigned num_workers;
+    struct worker *workers;
+
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    // Incremented for each pool_run, so that workers can tell a new job from a spurious wakeup
+    unsigned long generation;
+    unsigned running;
+    bool stopping;
+
+    pool_task_t *fn;
+    void *ctx;
+};
+
+static bool take(struct range *range, size_t *task) {
+    pthread_mutex_lock(&range->lock);
+    bool found = range->begin < range->end;
+    if(found) *task = range->begin++;
+    pthread_mutex_unlock(&range->lock);
+    return found;
+}
+
+// Moves the back half of a victim's tasks to the thief
+static bool steal(struct range *thief, struct range *victim) {
+    pthread_mutex_lock(&victim->lock);
+    size_t left = victim->end - victim->begin;
+    if(!left) {
+        pthread_mutex_unlock(&victim->lock);
+        return false;
+    }
+    size_t split = victim->end - (left + 1) / 2;
+    size_t end = victim->end;
+    victim->end = split;
+    pthread_mutex_unlock(&victim->lock);
+
+    pthread_mutex_lock(&thief->lock);
+    thief->begin = split;
+    thief->end = end;
+    pthread_mutex_unlock(&thief->lock);
+    return true;
+}
+
+static void run_tasks(struct worker *worker) {
+    struct pool *pool = worker->pool;
+    while(true) {
+        size_t task;
+        while(take(&worker->range, &task)) {
+            pool->fn(pool->ctx, task, worker->index);
+        }
+        // Look for work starting from the next worker along, so that thieves spread out
+        bool stolen = false;
+        for(unsigned i = 1; i < pool->num_workers && !stolen; i++) {
+            struct worker *victim = &pool->workers[(worker->index + i) % pool->num_workers];
+            stolen = steal(&worker->range, &victim->range);
+        }
+        // Tasks are never added once a job has started, so if every range was empty there's nothing left to do
+        if(!stolen) return;
+    }
+}
+
+static void *worker_main(void *arg) {
+    struct worker *worker = arg;
+    struct pool *pool = worker->pool;
+    unsigned long seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    while(true) {
+        while(pool->generation == seen && !pool->stopping) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if(pool->stopping) break;
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        run_tasks(worker);
+
+        pthread_mutex_lock(&pool->lock);
+        if(--pool->running == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+struct pool *pool_create(unsigned threads) {
+    if(!threads) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? cpus : 1;
+    }
+    struct pool *pool = calloc(1, sizeof *pool);
+    pool->num_workers = threads;
+    pool->workers = calloc(threads, sizeof *pool->workers);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    for(unsigned i = 0; i < threads; i++) {
+        struct worker *worker = &pool->workers[i];
+        worker->pool = pool;
+        worker->index = i;
+        pthread_mutex_init(&worker->range.lock, NULL);
+        if(pthread_create(&worker->thread, NULL, worker_main, worker) != 0) {
+            perror("pthread_create");
+            exit(1);
+        }
+    }
+    return pool;
+}
+
+void pool_destroy(struct pool *pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    for(unsigned i = 0; i < pool->num_workers; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+        pthread_mutex_destroy(&pool->workers[i].range.lock);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+    free(pool->workers);
+    free(pool);
+}
+
+unsigned pool_threads(const struct pool *pool) {
+    return pool->num_workers;
+}
+
+void pool_run(struct pool *pool, size_t num_tasks, pool_task_t *fn, void *ctx) {
+    if(!num_tasks) return;
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->ctx = ctx;
+    for(unsigned i = 0; i < pool->num_workers; i++) {
+        struct range *range = &pool->workers[i].range;
+        pthread_mutex_lock(&range->lock);
+        range->begin = num_tasks * i / pool->num_workers;
+        range->end = num_tasks * (i + 1) / pool->num_workers;
+        pthread_mutex_unlock(&range->lock);
+    }
+    pool->running = pool->num_workers;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    while(pool->running) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
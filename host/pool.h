@@ -0,0 +1,23 @@
+#ifndef WORDLE_HOST_POOL_H
+#define WORDLE_HOST_POOL_H
+
+#include <stddef.h>
+
+// A fixed set of worker threads that run numbered tasks. Each worker starts with an equal share of the tasks, and a
+// worker that runs out steals half of what another has left, so uneven tasks still keep every thread busy.
+
+struct pool;
+
+typedef void pool_task_t(void *ctx, size_t task, unsigned worker);
+
+// threads of 0 uses one per online CPU
+struct pool *pool_create(unsigned threads);
+void pool_destroy(struct pool *pool);
+
+unsigned pool_threads(const struct pool *pool);
+
+// Calls fn for every task in [0, num_tasks), and returns once they have all finished. worker is in
+// [0, pool_threads), and no two calls with the same worker run at once, so it can index per-thread scratch space.
+void pool_run(struct pool *pool, size_t num_tasks, pool_task_t *fn, void *ctx);
+
+#endif //WORDLE_HOST_POOL_H
@@ -0,0 +1,325 @@
+// Plays games through the same key handling as play_game, with no screen, and checks the board and the stats in the
+// save after every step. Keys either come from a file of scan codes, or are made up by a seeded player that makes
+// typos, submits short and made up words, quits part way through games and misses days.
+// Usage: simulate [-n games] [-s seed] [-k keys] WORDS.8xv ANSWERS.8xv
+//
+// A key file holds scan codes in decimal or 0x hex, separated by whitespace. 0x0f (clear) quits and resumes the game,
+// as if the program had been restarted. Each completed game moves on to the next day.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "appvar.h"
+#include "game.h"
+#include "wordlist.h"
+#include "words.h"
+
+#define KEY_CLEAR 0x0f
+
+// Frames of animation each event starts, from anim_lengths in src/graphics.c
+static const uint8_t event_frames[] = {
+        [GAME_NONE]      = 0,
+        [GAME_TYPED]     = 5,
+        [GAME_DELETED]   = 0,
+        [GAME_INVALID]   = 20,
+        [GAME_SUBMITTED] = 55,
+        [GAME_WON]       = 100,
+        [GAME_LOST]      = 55,
+};
+
+// Timing is also kept for resuming a game, which isn't an event
+#define TRANSITION_START (GAME_LOST + 1)
+#define NUM_TRANSITIONS (TRANSITION_START + 1)
+
+static const char *transition_names[NUM_TRANSITIONS] = {
+        [GAME_NONE]        = "none",
+        [GAME_TYPED]       = "typed",
+        [GAME_DELETED]     = "deleted",
+        [GAME_INVALID]     = "invalid",
+        [GAME_SUBMITTED]   = "submitted",
+        [GAME_WON]         = "won",
+        [GAME_LOST]        = "lost",
+        [TRANSITION_START] = "start",
+};
+
+static struct {
+    uint32_t count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+} transitions[NUM_TRANSITIONS];
+
+static uint64_t frames;
+static uint32_t failures;
+
+static uint8_t key_for_letter[26];
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void record(uint8_t transition, uint64_t ns) {
+    transitions[transition].count++;
+    transitions[transition].total_ns += ns;
+    if(ns > transitions[transition].max_ns) transitions[transition].max_ns = ns;
+}
+
+static void fail(const struct game *game, const char *what) {
+    if(failures++ < 10) {
+        fprintf(stderr, "day %u, guess %u: %s\n", game->save->day, game->save->num_guesses, what);
+    }
+}
+
+static uint32_t rng_state;
+
+static uint32_t rng(void) {
+    // xorshift32
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// What the stats should be, kept independently of the save
+struct model {
+    uint16_t games_played;
+    uint16_t current_streak;
+    uint16_t max_streak;
+    uint16_t guess_counts[MAX_GUESSES];
+};
+
+static void start_game(struct game *game, struct save *save) {
+    char word[WORD_LENGTH];
+    get_answer(save->day, word);
+    uint64_t start = now_ns();
+    game_start(game, save, word);
+    record(TRANSITION_START, now_ns() - start);
+}
+
+static enum game_event press(struct game *game, uint8_t key) {
+    struct save *save = game->save;
+    uint8_t row = save->num_guesses;
+    uint64_t start = now_ns();
+    enum game_event event = game_key(game, key);
+    record(event, now_ns() - start);
+    frames += event_frames[event];
+
+    switch(event) {
+        case GAME_SUBMITTED:
+        case GAME_WON:
+        case GAME_LOST: {
+            if(save->num_guesses != row + 1) fail(game, "row wasn't submitted");
+            for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+                enum tile_type expected = get_tile_type(save->guesses, row, i, game->word, save->num_guesses);
+                if(game->tiles[row][i] != expected) fail(game, "tile doesn't match get_tile_type");
+            }
+            bool correct = memcmp(save->guesses[row], game->word, WORD_LENGTH) == 0;
+            if(correct != (event == GAME_WON)) fail(game, "wrong result for guess");
+            if((event == GAME_LOST) != (!correct && save->num_guesses == MAX_GUESSES)) fail(game, "wrong loss");
+            if(game->completed != (event != GAME_SUBMITTED)) fail(game, "completed not updated");
+            break;
+        }
+        case GAME_INVALID: {
+            if(!game->message) fail(game, "invalid guess without a reason");
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    return event;
+}
+
+static void check_stats(const struct game *game, const struct model *model) {
+    const struct save *save = game->save;
+    if(save->games_played != model->games_played) fail(game, "games_played");
+    if(save->current_streak != model->current_streak) fail(game, "current_streak");
+    if(save->max_streak != model->max_streak) fail(game, "max_streak");
+    if(memcmp(save->guess_counts, model->guess_counts, sizeof model->guess_counts) != 0) fail(game, "guess_counts");
+}
+
+static void update_model(struct model *model, const struct save *save, bool won) {
+    model->games_played++;
+    if(won) {
+        model->guess_counts[save->num_guesses - 1]++;
+        model->current_streak++;
+        if(model->current_streak > model->max_streak) model->max_streak = model->current_streak;
+    } else {
+        model->current_streak = 0;
+    }
+}
+
+static void type_word(struct game *game, const char *word) {
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        press(game, key_for_letter[word[i] - 'A']);
+    }
+}
+
+// Picks the next guess, the answer more and more often on later rows. In hard mode, only guesses it allows.
+static void pick_guess(const struct game *game, char *guess) {
+    uint8_t row = game->save->num_guesses;
+    if(rng() % MAX_GUESSES < row) {
+        memcpy(guess, game->word, WORD_LENGTH);
+        return;
+    }
+    for(uint8_t tries = 0; tries < 50; tries++) {
+        wordlist_get(rng() % num_words, guess);
+        if(!(game->save->settings & SETTING_HARD) || constraints_allow(&game->constraints, guess)) return;
+    }
+    memcpy(guess, game->word, WORD_LENGTH);
+}
+
+// Types one row, with some mistakes along the way
+static void play_row(struct game *game) {
+    if(rng() % 8 == 0) {
+        // Typo, then delete it
+        press(game, key_for_letter[rng() % 26]);
+        press(game, GAME_KEY_DEL);
+    }
+    if(rng() % 10 == 0) {
+        // Submit too early, then clear the row
+        uint8_t letters = rng() % WORD_LENGTH;
+        for(uint8_t i = 0; i < letters; i++) press(game, key_for_letter[rng() % 26]);
+        press(game, GAME_KEY_ENTER);
+        while(game->input_index) press(game, GAME_KEY_DEL);
+    }
+    if(rng() % 10 == 0) {
+        // Something that probably isn't a word
+        for(uint8_t i = 0; i < WORD_LENGTH; i++) press(game, key_for_letter[rng() % 26]);
+        if(press(game, GAME_KEY_ENTER) != GAME_INVALID) return;
+        while(game->input_index) press(game, GAME_KEY_DEL);
+    }
+    char guess[WORD_LENGTH];
+    pick_guess(game, guess);
+    type_word(game, guess);
+    // Extra letters past the end of the row are ignored
+    if(rng() % 20 == 0) press(game, key_for_letter[rng() % 26]);
+    press(game, GAME_KEY_ENTER);
+}
+
+static void next_day(struct game *game, struct save *save, struct model *model, bool skip) {
+    uint16_t day = save->day + (skip ? 2 : 1);
+    if(day >= num_answers) day = 0;
+    if(day != save->day + 1) model->current_streak = 0;
+    save_start_day(save, day);
+    start_game(game, save);
+}
+
+static uint8_t *read_keys(const char *path, size_t *count) {
+    FILE *f = fopen(path, "r");
+    if(!f) {
+        perror(path);
+        exit(1);
+    }
+    size_t capacity = 1024;
+    uint8_t *keys = malloc(capacity);
+    *count = 0;
+    int key;
+    while(fscanf(f, "%i", &key) == 1) {
+        if(*count == capacity) keys = realloc(keys, capacity *= 2);
+        keys[(*count)++] = key;
+    }
+    fclose(f);
+    return keys;
+}
+
+int main(int argc, char **argv) {
+    uint32_t num_games = 10000;
+    uint32_t seed = 1;
+    const char *key_path = NULL;
+    int opt;
+    while((opt = getopt(argc, argv, "n:s:k:")) != -1) {
+        switch(opt) {
+            case 'n': num_games = strtoul(optarg, NULL, 0); break;
+            case 's': seed = strtoul(optarg, NULL, 0); break;
+            case 'k': key_path = optarg; break;
+            default: goto usage;
+        }
+    }
+    if(argc - optind != 2) {
+usage:
+        fprintf(stderr, "usage: %s [-n games] [-s seed] [-k keys] WORDS.8xv ANSWERS.8xv\n", argv[0]);
+        return 2;
+    }
+    if(!wordlist_init(load_appvar(argv[optind])) || !answers_init(load_appvar(argv[optind + 1]))) {
+        fprintf(stderr, "unsupported or mismatched appvars\n");
+        return 1;
+    }
+    rng_state = seed ? seed : 1;
+
+    for(uint8_t key = 0; key < 64; key++) {
+        char c = game_key_letter(key);
+        if(c) key_for_letter[c - 'A'] = key;
+    }
+
+    struct save save = {.settings = SETTING_DARK};
+    struct model model = {0};
+    struct game game;
+    save_start_day(&save, 0);
+    start_game(&game, &save);
+
+    uint32_t games = 0;
+    uint64_t start = now_ns();
+
+    if(key_path) {
+        size_t num_keys;
+        uint8_t *keys = read_keys(key_path, &num_keys);
+        for(size_t i = 0; i < num_keys; i++) {
+            if(keys[i] == KEY_CLEAR) {
+                start_game(&game, &save);
+                continue;
+            }
+            enum game_event event = press(&game, keys[i]);
+            if(event == GAME_WON || event == GAME_LOST) {
+                update_model(&model, &save, event == GAME_WON);
+                check_stats(&game, &model);
+                games++;
+                next_day(&game, &save, &model, false);
+            }
+        }
+        free(keys);
+    } else {
+        for(; games < num_games; games++) {
+            save.settings = rng() % 4 == 0 ? save.settings | SETTING_HARD : save.settings & ~SETTING_HARD;
+            while(!game.completed) {
+                play_row(&game);
+                if(!game.completed && rng() % 20 == 0) {
+                    // Quit and come back later the same day, which has to restore the board from the save
+                    struct save saved = save;
+                    start_game(&game, &save);
+                    if(memcmp(&saved, &save, sizeof save) != 0) fail(&game, "resuming changed the save");
+                }
+            }
+            bool won = memcmp(save.guesses[save.num_guesses - 1], game.word, WORD_LENGTH) == 0;
+            update_model(&model, &save, won);
+            check_stats(&game, &model);
+            next_day(&game, &save, &model, rng() % 10 == 0);
+        }
+    }
+
+    double elapsed = (now_ns() - start) / 1e9;
+    uint64_t total_transitions = 0;
+    for(uint8_t i = 0; i < NUM_TRANSITIONS; i++) total_transitions += transitions[i].count;
+
+    printf("%u games in %.3f s: %.0f games/s, %.0f transitions/s\n", games, elapsed, games / elapsed,
+           total_transitions / elapsed);
+    printf("%llu animation frames, %.1f hours at 30 fps\n", (unsigned long long)frames, frames / 30.0 / 3600);
+    printf("played %u, streak %u, max streak %u, guesses", save.games_played, save.current_streak, save.max_streak);
+    for(uint8_t i = 0; i < MAX_GUESSES; i++) printf(" %u", save.guess_counts[i]);
+    printf("\n\n%-10s %10s %10s %10s\n", "transition", "count", "mean ns", "max ns");
+    for(uint8_t i = 0; i < NUM_TRANSITIONS; i++) {
+        if(!transitions[i].count) continue;
+        printf("%-10s %10u %10.0f %10llu\n", transition_names[i], transitions[i].count,
+               (double)transitions[i].total_ns / transitions[i].count, (unsigned long long)transitions[i].max_ns);
+    }
+
+    if(failures) {
+        printf("\n%u checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
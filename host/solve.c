@@ -0,0 +1,244 @@
+// Ranks every allowed guess by the information its feedback gives about the answers that are still possible.
+// Usage: solve [-j threads] [-n count] [-H] [-m matrix] [-i index] [-r GUESS:feedback]... WORDS.8xv ANSWERS.8xv
+//
+// Each -r gives a row that has already been played, with its feedback as one character per tile: . for absent,
+// y for present and g for correct, e.g. -r RAISE:...yg. -H only ranks guesses that hard mode would accept.
+// The top count guesses are printed, or all of them with -n 0. -m looks feedback up in a matrix from mkmatrix instead
+// of scoring each pair, and -i narrows down the answers with an index from mkindex.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "answerset.h"
+#include "appvar.h"
+#include "batch.h"
+#include "constraints.h"
+#include "game.h"
+#include "invindex.h"
+#include "matrix.h"
+#include "pool.h"
+#include "util.h"
+#include "wordlist.h"
+#include "words.h"
+
+// Guesses per task. Small enough for stealing to even out the load, large enough to keep the locking cheap.
+#define TASK_GUESSES 32
+
+struct rating {
+    uint16_t guess;
+    bool candidate;
+    // Expected information from the feedback, in bits
+    double bits;
+    // Expected number of candidates left afterwards
+    double expected;
+};
+
+struct job {
+    char (*words)[WORD_LENGTH];
+    struct answer_columns candidates;
+    // The candidates as matrix columns
+    const struct matrix *matrix;
+    struct answer_set candidate_set;
+    // Per-guess flag for being one of the candidates
+    bool *is_candidate;
+    const struct constraints *hard;
+    struct rating *ratings;
+    // Feedback histogram for each worker
+    uint16_t (*buckets)[NUM_SCORES];
+    // Scores of one guess against every candidate, for each worker
+    uint8_t **scores;
+};
+
+static void rate_guesses(void *ctx, size_t task, unsigned worker) {
+    struct job *job = ctx;
+    uint16_t *buckets = job->buckets[worker];
+    size_t end = (task + 1) * TASK_GUESSES < num_words ? (task + 1) * TASK_GUESSES : num_words;
+    for(size_t g = task * TASK_GUESSES; g < end; g++) {
+        struct rating *rating = &job->ratings[g];
+        rating->guess = g;
+        rating->candidate = job->is_candidate[g];
+        if(job->hard && !constraints_allow(job->hard, job->words[g])) {
+            rating->bits = -1;
+            continue;
+        }
+        uint32_t num_candidates = job->candidates.count;
+        if(job->matrix) {
+            set_histogram(&job->candidate_set, matrix_row(job->matrix, g), buckets);
+        } else {
+            memset(buckets, 0, NUM_SCORES * sizeof *buckets);
+            uint8_t *scores = job->scores[worker];
+            batch_score(job->words[g], &job->candidates, scores);
+            for(uint32_t i = 0; i < num_candidates; i++) {
+                buckets[scores[i]]++;
+            }
+        }
+        double n = num_candidates;
+        double sum_log = 0;
+        double sum_sq = 0;
+        for(uint16_t s = 0; s < NUM_SCORES; s++) {
+            if(buckets[s]) {
+                sum_log += buckets[s] * log2(buckets[s]);
+                sum_sq += (double)buckets[s] * buckets[s];
+            }
+        }
+        rating->bits = log2(n) - sum_log / n;
+        rating->expected = sum_sq / n;
+    }
+}
+
+// Most information first, then guesses that could win outright, then word list order
+static int compare_ratings(const void *a, const void *b) {
+    const struct rating *x = a;
+    const struct rating *y = b;
+    if(x->bits != y->bits) return x->bits > y->bits ? -1 : 1;
+    if(x->candidate != y->candidate) return x->candidate ? -1 : 1;
+    return x->guess - y->guess;
+}
+
+static bool parse_row(const char *arg, char *guess, uint8_t *score) {
+    if(strlen(arg) != 2 * WORD_LENGTH + 1 || arg[WORD_LENGTH] != ':') return false;
+    *score = 0;
+    uint8_t place = 1;
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        char c = arg[i] & ~0x20;
+        if(c < 'A' || c > 'Z') return false;
+        guess[i] = c;
+        switch(arg[WORD_LENGTH + 1 + i]) {
+            case '.': break;
+            case 'y': *score += place; break;
+            case 'g': *score += 2 * place; break;
+            default: return false;
+        }
+        place *= 3;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    unsigned threads = 0;
+    uint32_t count = 20;
+    bool hard = false;
+    char rows[MAX_GUESSES][WORD_LENGTH];
+    uint8_t scores[MAX_GUESSES];
+    uint8_t num_rows = 0;
+    const char *matrix_path = NULL;
+    const char *index_path = NULL;
+
+    int opt;
+    while((opt = getopt(argc, argv, "j:n:Hm:i:r:")) != -1) {
+        switch(opt) {
+            case 'j': threads = strtoul(optarg, NULL, 0); break;
+            case 'n': count = strtoul(optarg, NULL, 0); break;
+            case 'H': hard = true; break;
+            case 'm': matrix_path = optarg; break;
+            case 'i': index_path = optarg; break;
+            case 'r': {
+                if(num_rows == MAX_GUESSES || !parse_row(optarg, rows[num_rows], &scores[num_rows])) {
+                    fprintf(stderr, "bad row %s\n", optarg);
+                    return 2;
+                }
+                num_rows++;
+                break;
+            }
+            default: goto usage;
+        }
+    }
+    if(argc - optind != 2) {
+usage:
+        fprintf(stderr, "usage: %s [-j threads] [-n count] [-H] [-m matrix] [-i index] [-r GUESS:feedback]... "
+                        "WORDS.8xv ANSWERS.8xv\n", argv[0]);
+        return 2;
+    }
+    if(!wordlist_init(load_appvar(argv[optind])) || !answers_init(load_appvar(argv[optind + 1]))) {
+        fprintf(stderr, "unsupported or mismatched appvars\n");
+        return 1;
+    }
+
+    // Answers are worked with as matrix columns, each only once even if it's used on several days
+    uint16_t *answer_words = malloc(num_answers * sizeof *answer_words);
+    uint16_t num_columns = matrix_answers(answer_words);
+    if(num_columns > MAX_SET_ANSWERS) {
+        fprintf(stderr, "more than %u answers\n", MAX_SET_ANSWERS);
+        return 1;
+    }
+    struct matrix matrix;
+    if(matrix_path && !matrix_open(&matrix, matrix_path)) return 1;
+    struct invindex index;
+    if(index_path && !invindex_open(&index, index_path)) return 1;
+
+    struct job job = {0};
+    job.words = malloc((size_t)num_words * WORD_LENGTH);
+    job.is_candidate = calloc(num_words, sizeof *job.is_candidate);
+    for(uint16_t i = 0; i < num_words; i++) {
+        wordlist_get(i, job.words[i]);
+    }
+
+    // The answers that fit every row. Rows guessing a word in the list can be applied with the index.
+    set_fill(&job.candidate_set, num_columns);
+    for(uint8_t row = 0; row < num_rows; row++) {
+        uint16_t found;
+        uint16_t guess = wordlist_prefix(rows[row], WORD_LENGTH, &found);
+        if(index_path && found) {
+            invindex_filter(&index, &job.candidate_set, guess, scores[row]);
+            continue;
+        }
+        for(int32_t i = set_next(&job.candidate_set, 0); i >= 0; i = set_next(&job.candidate_set, i + 1)) {
+            if(score_guess(rows[row], job.words[answer_words[i]]) != scores[row]) set_remove(&job.candidate_set, i);
+        }
+    }
+    uint16_t *members = malloc(num_columns * sizeof *members);
+    uint32_t num_candidates = set_members(&job.candidate_set, members);
+    if(!num_candidates) {
+        fprintf(stderr, "no answers fit those rows\n");
+        return 1;
+    }
+    char (*candidates)[WORD_LENGTH] = malloc((size_t)num_candidates * WORD_LENGTH);
+    for(uint32_t i = 0; i < num_candidates; i++) {
+        job.is_candidate[answer_words[members[i]]] = true;
+        memcpy(candidates[i], job.words[answer_words[members[i]]], WORD_LENGTH);
+    }
+    columns_init(&job.candidates, candidates, num_candidates);
+
+    struct constraints constraints;
+    if(hard) {
+        constraints_init(&constraints);
+        for(uint8_t row = 0; row < num_rows; row++) {
+            enum tile_type tiles[WORD_LENGTH];
+            decode_score(scores[row], tiles);
+            constraints_add(&constraints, rows[row], tiles);
+        }
+        job.hard = &constraints;
+    }
+
+    if(matrix_path) job.matrix = &matrix;
+
+    struct pool *pool = pool_create(threads);
+    job.ratings = malloc((size_t)num_words * sizeof *job.ratings);
+    job.buckets = malloc(pool_threads(pool) * sizeof *job.buckets);
+    job.scores = malloc(pool_threads(pool) * sizeof *job.scores);
+    for(unsigned i = 0; i < pool_threads(pool); i++) {
+        job.scores[i] = aligned_alloc(BATCH_LANES, job.candidates.stride);
+    }
+
+    double start = now();
+    pool_run(pool, (num_words + TASK_GUESSES - 1) / TASK_GUESSES, rate_guesses, &job);
+    double elapsed = now() - start;
+    threads = pool_threads(pool);
+    pool_destroy(pool);
+
+    qsort(job.ratings, num_words, sizeof *job.ratings, compare_ratings);
+
+    printf("%u candidates, %u guesses rated on %u threads in %.3f s\n\n", num_candidates, num_words,
+           threads, elapsed);
+    printf("%5s  %-5s  %6s  %8s  %s\n", "rank", "guess", "bits", "expected", "candidate");
+    for(uint32_t i = 0; i < num_words && (!count || i < count); i++) {
+        const struct rating *rating = &job.ratings[i];
+        if(rating->bits < 0) break;
+        printf("%5u  %.5s  %6.3f  %8.2f  %s\n", i + 1, job.words[rating->guess], rating->bits, rating->expected,
+               rating->candidate ? "yes" : "");
+    }
+    return 0;
+}
@@ -0,0 +1,9 @@
+#include "util.h"
+
+#include <time.h>
+
+double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
@@ -0,0 +1,7 @@
+#ifndef WORDLE_HOST_UTIL_H
+#define WORDLE_HOST_UTIL_H
+
+// Seconds on a monotonic clock, for timing
+double now(void);
+
+#endif //WORDLE_HOST_UTIL_H
@@ -0,0 +1,52 @@
+#include "bitset.h"
+
+#include <string.h>
+
+// Set bits in each nibble
+static const uint8_t nibble_count[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+void bitset_fill(uint8_t *set, uint16_t size) {
+    memset(set, 0xff, size / 8);
+    if(size & 7) {
+        set[size / 8] = (1 << (size & 7)) - 1;
+    }
+}
+
+bool bitset_test(const uint8_t *set, uint16_t i) {
+    return set[i >> 3] & 1 << (i & 7);
+}
+
+void bitset_clear(uint8_t *set, uint16_t i) {
+    set[i >> 3] &= ~(1 << (i & 7));
+}
+
+void bitset_and(uint8_t *set, const uint8_t *other, uint16_t size) {
+    for(uint16_t i = 0; i < BITSET_BYTES(size); i++) {
+        set[i] &= other[i];
+    }
+}
+
+uint16_t bitset_count(const uint8_t *set, uint16_t size) {
+    uint16_t count = 0;
+    for(uint16_t i = 0; i < BITSET_BYTES(size); i++) {
+        count += nibble_count[set[i] & 0xf] + nibble_count[set[i] >> 4];
+    }
+    return count;
+}
+
+uint16_t bitset_next(const uint8_t *set, uint16_t i, uint16_t size) {
+    while(i < size) {
+        uint8_t byte = set[i >> 3] >> (i & 7);
+        if(!byte) {
+            // Nothing left in this byte
+            i = (i | 7) + 1;
+            continue;
+        }
+        while(!(byte & 1)) {
+            byte >>= 1;
+            i++;
+        }
+        return i < size ? i : size;
+    }
+    return size;
+}
@@ -0,0 +1,25 @@
+#ifndef WORDLE_BITSET_H
+#define WORDLE_BITSET_H
+
+#include "wordle.h"
+
+// A set of numbers below some size, as one bit each, lowest bit first within each byte. Bytes are the widest thing
+// the eZ80 can test in one instruction, so whole empty bytes are skipped at once when searching.
+
+#define BITSET_BYTES(size) (((size) + 7) / 8)
+
+// Sets the first size bits and clears the rest of the last byte, so that counts don't pick up stray bits
+void bitset_fill(uint8_t *set, uint16_t size);
+
+bool bitset_test(const uint8_t *set, uint16_t i);
+void bitset_clear(uint8_t *set, uint16_t i);
+
+// Keeps only the members that are also in other
+void bitset_and(uint8_t *set, const uint8_t *other, uint16_t size);
+
+uint16_t bitset_count(const uint8_t *set, uint16_t size);
+
+// First member at or after i, or size if there is none
+uint16_t bitset_next(const uint8_t *set, uint16_t i, uint16_t size);
+
+#endif //WORDLE_BITSET_H
@@ -0,0 +1,81 @@
+#include "candidates.h"
+
+#include <string.h>
+
+#include "bitset.h"
+#include "words.h"
+
+static uint8_t bits[BITSET_BYTES(MAX_CANDIDATES)];
+static uint16_t num_candidates;
+
+static char rows[MAX_GUESSES][WORD_LENGTH];
+static uint8_t scores[MAX_GUESSES];
+static uint8_t num_rows;
+
+// Rows before checked_rows have been applied to every answer. A pass applies rows [checked_rows, pass_end) to every
+// answer, and has got as far as answer next. Rows added during a pass wait for the one after it.
+static uint8_t checked_rows;
+static uint8_t pass_end;
+static uint16_t next;
+
+// Count as of the last finished pass, and the running count during a pass
+static uint16_t count;
+static uint16_t pass_count;
+
+void candidates_init(void) {
+    num_candidates = num_answers < MAX_CANDIDATES ? num_answers : MAX_CANDIDATES;
+    bitset_fill(bits, num_candidates);
+    num_rows = 0;
+    checked_rows = 0;
+    pass_end = 0;
+    next = 0;
+    count = pass_count = num_candidates;
+}
+
+void candidates_add(const char *guess, uint8_t score) {
+    memcpy(rows[num_rows], guess, WORD_LENGTH);
+    scores[num_rows] = score;
+    num_rows++;
+}
+
+void candidates_update(uint16_t limit) {
+    if(!candidates_pending()) return;
+    if(next == 0) {
+        pass_end = num_rows;
+    }
+
+    for(; limit && (next = bitset_next(bits, next, num_candidates)) < num_candidates; next++) {
+        limit--;
+        char answer[WORD_LENGTH];
+        get_answer(next, answer);
+        for(uint8_t row = checked_rows; row < pass_end; row++) {
+            if(score_guess(rows[row], answer) != scores[row]) {
+                bitset_clear(bits, next);
+                pass_count--;
+                break;
+            }
+        }
+    }
+
+    if(next == num_candidates) {
+        checked_rows = pass_end;
+        count = pass_count;
+        next = 0;
+    }
+}
+
+bool candidates_pending(void) {
+    return checked_rows < num_rows;
+}
+
+bool candidates_contains(uint16_t day) {
+    return day < num_candidates && bitset_test(bits, day);
+}
+
+uint16_t candidates_next(uint16_t day) {
+    return bitset_next(bits, day, num_candidates);
+}
+
+uint16_t candidates_count(void) {
+    return count;
+}
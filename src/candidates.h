@@ -0,0 +1,34 @@
+#ifndef WORDLE_CANDIDATES_H
+#define WORDLE_CANDIDATES_H
+
+#include "wordle.h"
+
+// Which entries of the answer list still fit the feedback on the submitted rows, as one bit per answer.
+// Submitted rows are only queued by candidates_add - the list is narrowed by later calls to candidates_update,
+// a few answers at a time, so that the work can be spread out between frames.
+
+// Answers past this many are ignored, which is enough for the next decade of puzzles in 512 bytes
+#define MAX_CANDIDATES 4096
+
+// Must be called after answers_init, and before each new game
+void candidates_init(void);
+
+// Queues a submitted row and its score
+void candidates_add(const char *guess, uint8_t score);
+
+// Checks up to limit answers against the queued rows
+void candidates_update(uint16_t limit);
+
+// Whether there are queued rows that haven't been checked against every answer yet
+bool candidates_pending(void);
+
+// Whether the answer for a day still fits every row that has been checked
+bool candidates_contains(uint16_t day);
+
+// First day from the given one whose answer still fits, or past the end of the answer list if there is none
+uint16_t candidates_next(uint16_t day);
+
+// Number of answers that fit every row, as of the last time the rows were checked against every answer
+uint16_t candidates_count(void);
+
+#endif //WORDLE_CANDIDATES_H
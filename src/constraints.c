@@ -0,0 +1,76 @@
+#include "constraints.h"
+
+#include <string.h>
+
+#define LETTER_BIT(c) ((uint32_t)1 << ((c) - 'A'))
+
+void constraints_init(struct constraints *constraints) {
+    memset(constraints, 0, sizeof *constraints);
+}
+
+void constraints_add(struct constraints *constraints, const char *guess, const enum tile_type tiles[WORD_LENGTH]) {
+    // Correct and present tiles for each letter in this row
+    uint8_t shown[26] = {0};
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        if(tiles[i] == TILE_CORRECT) {
+            constraints->fixed[i] = guess[i];
+        } else {
+            constraints->not_at[i] |= LETTER_BIT(guess[i]);
+        }
+        if(tiles[i] != TILE_ABSENT) {
+            shown[guess[i] - 'A']++;
+        }
+    }
+
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        char c = guess[i];
+        uint8_t count = shown[c - 'A'];
+        if(!count) {
+            // Scoring uses up a letter for every earlier tile with it, so the first tile with a letter can only be
+            // absent if every copy in the answer is under a correct tile. With none correct, there are none at all.
+            constraints->excluded |= LETTER_BIT(c);
+        } else if(count > constraints->min_count[c - 'A']) {
+            if(!constraints->min_count[c - 'A']) {
+                constraints->required[constraints->num_required++] = c;
+            }
+            constraints->min_count[c - 'A'] = count;
+        }
+    }
+}
+
+int8_t constraints_missing_fixed(const struct constraints *constraints, const char *word) {
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        if(constraints->fixed[i] && word[i] != constraints->fixed[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+char constraints_missing_letter(const struct constraints *constraints, const char *word) {
+    for(uint8_t i = 0; i < constraints->num_required; i++) {
+        char c = constraints->required[i];
+        uint8_t count = 0;
+        for(uint8_t j = 0; j < WORD_LENGTH; j++) {
+            if(word[j] == c) count++;
+        }
+        if(count < constraints->min_count[c - 'A']) {
+            return c;
+        }
+    }
+    return 0;
+}
+
+bool constraints_allow(const struct constraints *constraints, const char *word) {
+    return constraints_missing_fixed(constraints, word) < 0 && !constraints_missing_letter(constraints, word);
+}
+
+bool constraints_match(const struct constraints *constraints, const char *word) {
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        uint32_t bit = LETTER_BIT(word[i]);
+        if((constraints->excluded | constraints->not_at[i]) & bit) {
+            return false;
+        }
+    }
+    return constraints_allow(constraints, word);
+}
@@ -0,0 +1,40 @@
+#ifndef WORDLE_CONSTRAINTS_H
+#define WORDLE_CONSTRAINTS_H
+
+#include "wordle.h"
+
+// What the feedback on the submitted rows says about the answer. Built up one row at a time, so checking a word
+// against it doesn't need to look at earlier guesses again.
+struct constraints {
+    // Letter shown as correct at each position, or 0
+    char fixed[WORD_LENGTH];
+    // Letters that can't be at each position, one bit per letter
+    uint32_t not_at[WORD_LENGTH];
+    // Fewest times each letter can appear in the answer
+    uint8_t min_count[26];
+    // Letters with a nonzero min_count, in the order they were first revealed
+    char required[WORD_LENGTH];
+    uint8_t num_required;
+    // Letters that aren't in the answer at all
+    uint32_t excluded;
+};
+
+void constraints_init(struct constraints *constraints);
+
+// Adds the information from a submitted row
+void constraints_add(struct constraints *constraints, const char *guess, const enum tile_type tiles[WORD_LENGTH]);
+
+// First position where the word doesn't have a letter shown as correct, or -1 if there is none
+int8_t constraints_missing_fixed(const struct constraints *constraints, const char *word);
+
+// First revealed letter that the word doesn't have enough of, or 0 if there is none
+char constraints_missing_letter(const struct constraints *constraints, const char *word);
+
+// Whether the word uses every correct and present tile, as hard mode requires
+bool constraints_allow(const struct constraints *constraints, const char *word);
+
+// Whether the word could still be the answer. This is a necessary condition rather than an exact one: scoring
+// every guess against the word is the only way to be sure.
+bool constraints_match(const struct constraints *constraints, const char *word);
+
+#endif //WORDLE_CONSTRAINTS_H
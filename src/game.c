@@ -0,0 +1,239 @@
+#include "game.h"
+
+#include <string.h>
+
+#include "wordlist.h"
+#include "candidates.h"
+#include "hint.h"
+
+enum tile_type get_tile_type(const char guesses[][WORD_LENGTH], uint8_t guess, uint8_t pos, const char *word, uint8_t num_guesses) {
+    char c = guesses[guess][pos];
+    if(!c) {
+        return TILE_EMPTY;
+    } else if(guess == num_guesses) {
+        return TILE_UNSUBMITTED;
+    } else if(c == word[pos]) {
+        return TILE_CORRECT;
+    } else {
+        // Count occurrences in answer
+        uint8_t count_answer = 0;
+        uint8_t count_correct = 0;
+        for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+            if(c == word[i]) {
+                count_answer++;
+                if(guesses[guess][i] == word[i]) {
+                    count_correct++;
+                }
+            }
+        }
+        // Count how many tiles with this letter have already been shown as present or correct
+        uint8_t count_prev = 0;
+        for(uint8_t i = 0; i < pos; i++) {
+            if(c == guesses[guess][i]) {
+                count_prev++;
+            }
+        }
+        // Only mark present if there are fewer of this character already marked than there are in the answer
+        if(count_answer - count_correct > count_prev) return TILE_PRESENT;
+        else return TILE_ABSENT;
+    }
+}
+
+uint8_t score_guess(const char *guess, const char *answer) {
+    // Occurrences of each letter in the answer that aren't matched by a correct tile
+    int8_t remaining[26] = {0};
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        if(guess[i] != answer[i]) {
+            remaining[answer[i] - 'A']++;
+        }
+    }
+    // Like get_tile_type, every earlier tile with the same letter uses one up, whatever its color
+    uint8_t score = 0;
+    uint8_t place = 1;
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        int8_t *count = &remaining[guess[i] - 'A'];
+        if(guess[i] == answer[i]) {
+            score += 2 * place;
+        } else if(*count > 0) {
+            score += place;
+        }
+        (*count)--;
+        place *= 3;
+    }
+    return score;
+}
+
+void decode_score(uint8_t score, enum tile_type tiles[WORD_LENGTH]) {
+    for(uint8_t i = 0; i < WORD_LENGTH; i++) {
+        tiles[i] = TILE_ABSENT + score % 3;
+        score /= 3;
+    }
+}
+
+uint8_t encode_score(const enum tile_type tiles[WORD_LENGTH]) {
+    uint8_t score = 0;
+    for(uint8_t i = WORD_LENGTH; i > 0; i--) {
+        score = score * 3 + tiles[i - 1] - TILE_ABSENT;
+    }
+    return score;
+}
+
+void score_row(enum tile_type tiles[WORD_LENGTH], const char guesses[][WORD_LENGTH], uint8_t guess, const char *word) {
+    decode_score(score_guess(guesses[guess], word), tiles);
+}
+
+const char *validate_word(const char guesses[][WORD_LENGTH], uint8_t cur_guess, const struct constraints *constraints, uint8_t settings) {
+    const char *guess = guesses[cur_guess];
+    if(strnlen(guess, 5) != 5) return "Not enough letters";
+    if(!is_word_in_list(guess)) return "Not in word list";
+
+    if(settings & SETTING_HARD) {
+        int8_t pos = constraints_missing_fixed(constraints, guess);
+        if(pos >= 0) {
+            static char text_position[] = "___ letter must be _";
+            const char ordinals[WORD_LENGTH][3] = {"1st", "2nd", "3rd", "4th", "5th"};
+            memcpy(text_position, ordinals[pos], 3);
+            text_position[19] = constraints->fixed[pos];
+            return text_position;
+        }
+        char missing = constraints_missing_letter(constraints, guess);
+        if(missing) {
+            static char text_contains[] = "Guess must contain _";
+            text_contains[19] = missing;
+            return text_contains;
+        }
+    }
+    return NULL;
+}
+
+int get_day_number(time_t current) {
+    time_t start = 1624060800;
+    return (long)(current - start) / (60 * 60 * 24);
+}
+
+void save_start_day(struct save *save, int day) {
+    if(save->day != day) {
+        if(save->day != day - 1) {
+            save->current_streak = 0;
+        }
+        memset(save->guesses, 0, sizeof save->guesses);
+        save->num_guesses = 0;
+    }
+    save->day = day;
+}
+
+void save_record_win(struct save *save) {
+    save->games_played++;
+    save->guess_counts[save->num_guesses - 1]++;
+    save->current_streak++;
+    if(save->current_streak > save->max_streak) {
+        save->max_streak = save->current_streak;
+    }
+}
+
+void save_record_loss(struct save *save) {
+    save->games_played++;
+    save->current_streak = 0;
+}
+
+void game_start(struct game *game, struct save *save, const char *word) {
+    game->save = save;
+    memcpy(game->word, word, WORD_LENGTH);
+    game->word[WORD_LENGTH] = 0;
+    game->input_index = 0;
+    game->message = NULL;
+
+    memset(game->tiles, 0, sizeof game->tiles);
+    constraints_init(&game->constraints);
+    candidates_init();
+    hint_cancel();
+    for(uint8_t i = 0; i < save->num_guesses; i++) {
+        score_row(game->tiles[i], save->guesses, i, word);
+        constraints_add(&game->constraints, save->guesses[i], game->tiles[i]);
+        candidates_add(save->guesses[i], score_guess(save->guesses[i], word));
+    }
+    // A finished game has no row in progress, and guesses[MAX_GUESSES] would be past the end of the save
+    if(save->num_guesses < MAX_GUESSES) {
+        game->input_index = strnlen(save->guesses[save->num_guesses], WORD_LENGTH);
+        for(uint8_t i = 0; i < game->input_index; i++) {
+            game->tiles[save->num_guesses][i] = TILE_UNSUBMITTED;
+        }
+    }
+
+    game->completed = save->num_guesses == MAX_GUESSES ||
+                      (save->num_guesses && memcmp(save->guesses[save->num_guesses - 1], word, WORD_LENGTH) == 0);
+}
+
+char game_key_letter(uint8_t key) {
+    const char *chars = "\0\0\0\0\0\0\0\0\0\0\0WRMH\0\0\0\0VQLG\0\0\0ZUPKFC\0\0YTOJEB\0\0XSNIDA\0\0\0\0\0\0\0\0";
+    return key < 56 ? chars[key] : 0;
+}
+
+// Scores the current row and moves on to the next
+static void submit_row(struct game *game) {
+    struct save *save = game->save;
+    uint8_t row = save->num_guesses;
+    score_row(game->tiles[row], save->guesses, row, game->word);
+    constraints_add(&game->constraints, save->guesses[row], game->tiles[row]);
+    candidates_add(save->guesses[row], score_guess(save->guesses[row], game->word));
+    hint_cancel();
+    save->num_guesses++;
+    game->input_index = 0;
+}
+
+static enum game_event submit(struct game *game) {
+    struct save *save = game->save;
+    if(memcmp(save->guesses[save->num_guesses], game->word, WORD_LENGTH) == 0) {
+        submit_row(game);
+        save_record_win(save);
+        game->completed = true;
+        static const char *results[] = {
+                "Genius",
+                "Magnificent",
+                "Impressive",
+                "Splendid",
+                "Great",
+                "Phew",
+        };
+        game->message = results[save->num_guesses - 1];
+        return GAME_WON;
+    }
+
+    game->message = validate_word(save->guesses, save->num_guesses, &game->constraints, save->settings);
+    if(game->message) {
+        return GAME_INVALID;
+    }
+
+    submit_row(game);
+    if(save->num_guesses == MAX_GUESSES) {
+        game->completed = true;
+        save_record_loss(save);
+        game->message = game->word;
+        return GAME_LOST;
+    }
+    return GAME_SUBMITTED;
+}
+
+enum game_event game_key(struct game *game, uint8_t key) {
+    struct save *save = game->save;
+    if(game->completed) return GAME_NONE;
+
+    if(key == GAME_KEY_ENTER) {
+        return submit(game);
+    }
+
+    if(key == GAME_KEY_DEL) {
+        if(!game->input_index) return GAME_NONE;
+        game->input_index--;
+        save->guesses[save->num_guesses][game->input_index] = 0;
+        game->tiles[save->num_guesses][game->input_index] = TILE_EMPTY;
+        return GAME_DELETED;
+    }
+
+    char c = game_key_letter(key);
+    if(!c || game->input_index == WORD_LENGTH) return GAME_NONE;
+    save->guesses[save->num_guesses][game->input_index] = c;
+    game->tiles[save->num_guesses][game->input_index] = TILE_UNSUBMITTED;
+    game->input_index++;
+    return GAME_TYPED;
+}
@@ -0,0 +1,68 @@
+#ifndef WORDLE_GAME_H
+#define WORDLE_GAME_H
+
+#include <time.h>
+
+#include "wordle.h"
+#include "constraints.h"
+
+// Game rules and save handling, with no dependencies on the calculator, so that they can also be built for the host
+// (see host/makefile). The scoring functions are declared in wordle.h.
+
+// Scan codes of the keys that game_key handles, the same as the OS's sk_ values
+#define GAME_KEY_ENTER 0x09
+#define GAME_KEY_DEL   0x38
+
+// What a key did, so that the caller knows what to show
+enum game_event {
+    // Nothing happened
+    GAME_NONE,
+    GAME_TYPED,
+    GAME_DELETED,
+    // The guess can't be submitted, for the reason in message
+    GAME_INVALID,
+    // The guess was scored, and the game goes on
+    GAME_SUBMITTED,
+    // The guess was correct. message holds the result.
+    GAME_WON,
+    // The last guess was wrong. message holds the answer.
+    GAME_LOST,
+};
+
+// A game in progress, for the day the save is on
+struct game {
+    struct save *save;
+    char word[WORD_LENGTH + 1];
+    // Letters typed on the current row
+    uint8_t input_index;
+    // Rows are scored once, when they are submitted - everything else just reads the result
+    enum tile_type tiles[MAX_GUESSES][WORD_LENGTH];
+    struct constraints constraints;
+    bool completed;
+    const char *message;
+};
+
+// Starts or resumes a game from the save, which must already be on the answer's day (see save_start_day).
+// The candidates are reset to match.
+void game_start(struct game *game, struct save *save, const char *word);
+
+// Handles a letter, enter or delete key. Anything else is ignored.
+enum game_event game_key(struct game *game, uint8_t key);
+
+// Letter typed by a key, or 0 if it doesn't type one
+char game_key_letter(uint8_t key);
+
+// Returns NULL if the guess on row cur_guess can be submitted, or the reason it can't be
+const char *validate_word(const char guesses[][WORD_LENGTH], uint8_t cur_guess, const struct constraints *constraints, uint8_t settings);
+
+// Number of the puzzle for a time
+int get_day_number(time_t current);
+
+// Clears the board if the save is from an earlier day, and breaks the streak if a day was missed
+void save_start_day(struct save *save, int day);
+
+// Updates the stats once the game is over. num_guesses must include the final guess.
+void save_record_win(struct save *save);
+void save_record_loss(struct save *save);
+
+#endif //WORDLE_GAME_H
@@ -1,10 +1,13 @@
 #include "graphics.h"
 
+#include <string.h>
 #include <graphx.h>
 #include <time.h>
 #include <tice.h>
 
 #include "gfx/gfx.h"
+#include "profile.h"
+#include "input.h"
 
 #define TILE_SIZE 24
 #define TILE_SPACING 3
@@ -63,41 +66,120 @@ struct tile {
     uint8_t height;
 };
 
+struct rect {
+    uint24_t x;
+    uint8_t y;
+    uint24_t width;
+    uint8_t height;
+};
+
+#define TOAST_LENGTH 32
+#define NUM_ITEMS (1 + MAX_GUESSES * WORD_LENGTH)
+
+// What was last drawn to each of the two buffers, so that a frame only has to redraw what changed since then
+struct buffer_state {
+    bool valid;
+    struct tile tiles[MAX_GUESSES][WORD_LENGTH];
+    char toast[TOAST_LENGTH];
+    uint16_t words_left;
+};
+
+static struct buffer_state buffers[2];
+static uint8_t cur_buffer;
+
+// Letters at the size used by full-height tiles, pre-rendered so that they can be drawn as a sprite rather than
+// through the slow scaled text routines. Tile text is either COLOR_WHITE or COLOR_TEXT, with a COLOR_BG (transparent)
+// background. The sprites hold palette indices, so they stay valid when the palette changes.
+#define GLYPH_SCALE 2
+#define GLYPH_SIZE (8 * GLYPH_SCALE)
+#define NUM_LETTERS 26
+
+struct glyph_atlas {
+    uint8_t width[NUM_LETTERS];
+    uint8_t sprites[2][NUM_LETTERS][2 + GLYPH_SIZE * GLYPH_SIZE];
+};
+
+static struct glyph_atlas atlas;
+
+#ifndef NDEBUG
+// Shown in the profile overlay
+static struct {
+    // Timer ticks spent drawing the last frame, out of a budget of FRAME_TICKS
+    uint32_t render_ticks;
+    // Animation frames that were skipped because drawing couldn't keep up, since the overlay was shown
+    uint16_t skipped;
+} frame_timing;
+#endif
+
+static void build_atlas(void);
+static uint8_t get_anim_frame(const struct anim_state *state, uint32_t time);
+static void swap_buffers(void);
+static void invalidate_buffers(void);
+static bool tiles_equal(const struct tile *a, const struct tile *b);
+static struct rect get_tile_rect(const struct tile *tile);
+static struct rect get_toast_rect(const char *toast);
+static bool rects_overlap(const struct rect *a, const struct rect *b);
+static void fill_rect(const struct rect *rect);
 static void draw_tile(const struct tile *tile);
 static void get_tile_colors(struct tile *tile, enum tile_type type);
 static void flip_tile(struct tile *tile, int frame);
 static void disp_title(void);
 static void disp_toast(const char *toast);
+static void disp_icons(void);
+static void disp_words_left(uint16_t words_left);
+#ifndef NDEBUG
+static void disp_profile(void);
+#endif
 
 void graphics_init(void) {
     gfx_Begin();
     graphics_set_palette(SETTING_DARK);
     gfx_FillScreen(COLOR_BG);
     gfx_SetDrawBuffer();
+    build_atlas();
     timer_Enable(1, TIMER_32K, TIMER_NOINT, TIMER_UP);
     timer_Set(1, 0);
+    profile_init();
 }
 
 void graphics_cleanup(void) {
     gfx_End();
 }
 
-void graphics_frame(uint8_t cur_line, const char *word, const char guesses[][WORD_LENGTH], const char *toast, struct anim_state *anim_state) {
-    gfx_SwapDraw();
-    gfx_FillScreen(COLOR_BG);
+bool graphics_frame(uint8_t cur_line, const char guesses[][WORD_LENGTH], const enum tile_type tiles[][WORD_LENGTH], const char *toast, uint16_t words_left, struct anim_state *anim_state) {
+    struct buffer_state *buf = &buffers[cur_buffer];
+    static struct tile new_tiles[MAX_GUESSES][WORD_LENGTH];
+    char new_toast[TOAST_LENGTH] = "";
 
-    disp_title();
+    profile_begin_frame();
+
+    uint32_t frame_start = timer_Get(1);
+#ifndef NDEBUG
+    uint8_t prev_frame = anim_state->frame;
+#endif
+    anim_state->frame = get_anim_frame(anim_state, frame_start);
+#ifndef NDEBUG
+    if(prev_frame > anim_state->frame + 1) frame_timing.skipped += prev_frame - anim_state->frame - 1;
+#endif
+
+    if(!buf->valid) {
+        gfx_FillScreen(COLOR_BG);
+        profile_mark(PROFILE_CLEAR);
+        disp_title();
+        profile_mark(PROFILE_TITLE);
+        disp_icons();
+        profile_mark(PROFILE_ICONS);
+    }
 
     if(toast && (anim_state->frame == 0 || anim_state->animation == ANIM_INVALID_WORD)) {
-        disp_toast(toast);
+        strncpy(new_toast, toast, TOAST_LENGTH - 1);
     }
 
     for(uint8_t y = 0; y < MAX_GUESSES; y++) {
         for(uint8_t x = 0; x < WORD_LENGTH; x++) {
-            enum tile_type type = get_tile_type(guesses, y, x, word, cur_line);
             struct tile tile;
             tile.c = guesses[y][x];
-            get_tile_colors(&tile, type);
+            get_tile_colors(&tile, tiles[y][x]);
 
             tile.center_x = TILE_BASE_X + (TILE_SIZE + TILE_SPACING) * x;
             tile.center_y = TILE_BASE_Y + (TILE_SIZE + TILE_SPACING) * y;
@@ -111,7 +193,8 @@ void graphics_frame(uint8_t cur_line, const char *word, const char guesses[][WOR
                         if(y == cur_line && (x == WORD_LENGTH - 1 || !guesses[y][x+1]) && guesses[y][x]) {
                             if(anim_state->frame == 5) {
                                 // skip drawing this tile this frame
-                                continue;
+                                tile.width = tile.height = 0;
+                                break;
                             }
                             const int8_t sizes[] = {1, 2, 1, -1, 0};
                             tile.width = TILE_SIZE + sizes[anim_state->frame - 1];
@@ -156,36 +239,200 @@ void graphics_frame(uint8_t cur_line, const char *word, const char guesses[][WOR
                 }
             }
 
-            draw_tile(&tile);
+            new_tiles[y][x] = tile;
         }
     }
 
-    const uint8_t icon_y = LCD_HEIGHT - 22;
-    gfx_RLETSprite_NoClip(icon_help, 1 * LCD_WIDTH / 10 - icon_help_width / 2, icon_y);
-    gfx_RLETSprite_NoClip(icon_stats, 7 * LCD_WIDTH / 10 - icon_stats_width / 2, icon_y);
-    gfx_RLETSprite_NoClip(icon_settings, 9 * LCD_WIDTH / 10 - icon_settings_width / 2, icon_y);
+    // Item 0 is the toast, and the rest are the tiles, in the order they are drawn
+    struct rect old_rects[NUM_ITEMS];
+    struct rect new_rects[NUM_ITEMS];
+    bool changed[NUM_ITEMS];
+    bool redraw[NUM_ITEMS];
+
+    old_rects[0] = get_toast_rect(buf->toast);
+    new_rects[0] = get_toast_rect(new_toast);
+    changed[0] = !buf->valid || strcmp(buf->toast, new_toast) != 0;
+    for(uint8_t i = 1; i < NUM_ITEMS; i++) {
+        const struct tile *old_tile = &buf->tiles[0][i - 1];
+        const struct tile *new_tile = &new_tiles[0][i - 1];
+        old_rects[i] = get_tile_rect(old_tile);
+        new_rects[i] = get_tile_rect(new_tile);
+        changed[i] = !buf->valid || !tiles_equal(old_tile, new_tile);
+    }
+
+    profile_mark(PROFILE_SCORING);
+
+    // Clear whatever changed from this buffer. Anything else under a cleared area has to be redrawn too.
+    gfx_SetColor(COLOR_BG);
+    for(uint8_t i = 0; i < NUM_ITEMS; i++) {
+        redraw[i] = changed[i];
+        if(changed[i] && buf->valid) {
+            fill_rect(&old_rects[i]);
+        }
+    }
+    profile_mark(PROFILE_CLEAR);
+    for(uint8_t i = 0; i < NUM_ITEMS; i++) {
+        if(changed[i] || !buf->valid) continue;
+        for(uint8_t j = 0; j < NUM_ITEMS; j++) {
+            if(changed[j] && rects_overlap(&old_rects[j], &new_rects[i])) {
+                redraw[i] = true;
+                break;
+            }
+        }
+    }
+    // Anything drawn on top of something that's being redrawn has to be redrawn as well to stay on top
+    for(uint8_t i = 0; i < NUM_ITEMS; i++) {
+        if(!redraw[i]) continue;
+        for(uint8_t j = i + 1; j < NUM_ITEMS; j++) {
+            if(rects_overlap(&new_rects[i], &new_rects[j])) {
+                redraw[j] = true;
+            }
+        }
+    }
+
+    profile_mark(PROFILE_SCORING);
+
+    if(redraw[0] && new_toast[0]) {
+        disp_toast(new_toast);
+    }
+    profile_mark(PROFILE_TOAST);
+    for(uint8_t i = 1; i < NUM_ITEMS; i++) {
+        if(redraw[i]) {
+            draw_tile(&new_tiles[0][i - 1]);
+        }
+        // Redrawing every tile is slow enough that a quick tap could otherwise go unnoticed
+        if(i % WORD_LENGTH == 0) {
+            input_poll();
+        }
+    }
+    profile_mark(PROFILE_TILES);
+
+    // Sits between the icons, clear of everything else
+    if(!buf->valid || buf->words_left != words_left) {
+        disp_words_left(words_left);
+    }
+    profile_mark(PROFILE_ICONS);
+
+    memcpy(buf->tiles, new_tiles, sizeof new_tiles);
+    strcpy(buf->toast, new_toast);
+    buf->words_left = words_left;
+    buf->valid = true;
 
 #ifndef NDEBUG
     // debug stuff
+    static uint32_t last_frame_start;
+    gfx_SetColor(COLOR_BG);
+    gfx_FillRectangle_NoClip(2, 30, 32, 28);
     gfx_SetTextFGColor(COLOR_TEXT);
     gfx_SetTextScale(1, 1);
     gfx_SetTextXY(2, 30);
-    gfx_PrintUInt(32768 / timer_Get(1), 1);
-    timer_Set(1, 0);
+    gfx_PrintUInt(frame_start != last_frame_start ? TIMER_FREQ / (frame_start - last_frame_start) : 0, 1);
+    last_frame_start = frame_start;
     gfx_SetTextXY(2, 40);
     gfx_PrintUInt(anim_state->animation, 1);
     gfx_SetTextXY(2, 50);
     gfx_PrintUInt(anim_state->frame, 1);
+    if(profile_overlay) {
+        disp_profile();
+    }
 #endif
 
-    if(anim_state->frame) {
-        anim_state->frame--;
-    }
+    swap_buffers();
+#ifndef NDEBUG
+    // Otherwise the wait for the swap would be counted against whatever draws first next frame
+    gfx_Wait();
+    profile_mark(PROFILE_SWAP);
+    profile_end_frame();
+    frame_timing.render_ticks = timer_Get(1) - frame_start;
+#endif
+
+    // The final state still has to be drawn once the animation ends
+    return anim_state->frame;
 }
 
 void graphics_start_anim(struct anim_state *state, enum animation anim) {
     state->animation = anim;
     state->frame = anim_lengths[anim];
+    state->start = timer_Get(1);
+}
+
+bool graphics_frame_due(const struct anim_state *state) {
+    return get_anim_frame(state, timer_Get(1)) != state->frame;
+}
+
+static uint8_t get_anim_frame(const struct anim_state *state, uint32_t time) {
+    uint32_t elapsed = (time - state->start) / FRAME_TICKS;
+    uint8_t length = anim_lengths[state->animation];
+    return elapsed < length ? length - elapsed : 0;
+}
+
+static void build_atlas(void) {
+    gfx_SetTextScale(GLYPH_SCALE, GLYPH_SCALE);
+    for(uint8_t col = 0; col < 2; col++) {
+        gfx_SetTextFGColor(col ? COLOR_TEXT : COLOR_WHITE);
+        for(uint8_t i = 0; i < NUM_LETTERS; i++) {
+            char c = 'A' + i;
+            gfx_sprite_t *sprite = (gfx_sprite_t*)atlas.sprites[col][i];
+            atlas.width[i] = gfx_GetCharWidth(c);
+            sprite->width = atlas.width[i];
+            sprite->height = GLYPH_SIZE;
+            gfx_SetColor(COLOR_BG);
+            gfx_FillRectangle_NoClip(0, 0, GLYPH_SIZE, GLYPH_SIZE);
+            gfx_SetTextXY(0, 0);
+            gfx_PrintChar(c);
+            gfx_GetSprite(sprite, 0, 0);
+        }
+    }
+}
+
+static void swap_buffers(void) {
+    gfx_SwapDraw();
+    cur_buffer ^= 1;
+}
+
+// For screens that draw over the whole game board
+static void invalidate_buffers(void) {
+    buffers[0].valid = false;
+    buffers[1].valid = false;
+}
+
+static bool tiles_equal(const struct tile *a, const struct tile *b) {
+    return a->c == b->c && a->bg == b->bg && a->border == b->border && a->text_col == b->text_col &&
+           a->center_x == b->center_x && a->center_y == b->center_y && a->width == b->width && a->height == b->height;
+}
+
+static struct rect get_tile_rect(const struct tile *tile) {
+    struct rect rect = {
+            .x = tile->center_x - tile->width / 2,
+            .y = tile->center_y - tile->height / 2,
+            .width = tile->width,
+            .height = tile->height,
+    };
+    return rect;
+}
+
+static struct rect get_toast_rect(const char *toast) {
+    struct rect rect = {0, 0, 0, 0};
+    if(toast[0]) {
+        gfx_SetTextScale(1, 1);
+        rect.width = gfx_GetStringWidth(toast) + 8;
+        rect.x = (LCD_WIDTH - rect.width) / 2;
+        rect.y = 32;
+        rect.height = 16;
+    }
+    return rect;
+}
+
+static bool rects_overlap(const struct rect *a, const struct rect *b) {
+    return a->width && a->height && b->width && b->height &&
+           a->x < b->x + b->width && b->x < a->x + a->width &&
+           a->y < b->y + b->height && b->y < a->y + a->height;
+}
+
+static void fill_rect(const struct rect *rect) {
+    if(rect->width && rect->height) {
+        gfx_FillRectangle_NoClip(rect->x, rect->y, rect->width, rect->height);
+    }
 }
 
 static void flip_tile(struct tile *tile, int frame) {
@@ -199,16 +446,23 @@ static void flip_tile(struct tile *tile, int frame) {
 }
 
 static void draw_tile(const struct tile *tile) {
+    if(!tile->width || !tile->height) return;
     uint24_t base_x = tile->center_x - tile->width / 2;
     uint24_t base_y = tile->center_y - tile->height / 2;
     if(tile->bg != COLOR_BG) {
         gfx_SetColor(tile->bg);
         gfx_FillRectangle_NoClip(base_x, base_y, tile->width, tile->height);
     }
-    gfx_SetColor(tile->border);
-    gfx_Rectangle_NoClip(base_x, base_y, tile->width, tile->height);
+    if(tile->border != tile->bg) {
+        gfx_SetColor(tile->border);
+        gfx_Rectangle_NoClip(base_x, base_y, tile->width, tile->height);
+    }
     uint8_t height_scale = (tile->height - 4) / 8;
-    if(tile->c && height_scale) {
+    if(tile->c >= 'A' && tile->c <= 'Z' && height_scale == GLYPH_SCALE) {
+        uint8_t i = tile->c - 'A';
+        const gfx_sprite_t *sprite = (const gfx_sprite_t*)atlas.sprites[tile->text_col == COLOR_TEXT][i];
+        gfx_TransparentSprite_NoClip(sprite, tile->center_x - atlas.width[i] / 2 + 1, tile->center_y - GLYPH_SIZE / 2 + 1);
+    } else if(tile->c && height_scale) {
         gfx_SetTextScale(2, height_scale);
         gfx_SetTextFGColor(tile->text_col);
         gfx_SetTextXY(tile->center_x - gfx_GetCharWidth(tile->c) / 2 + 1, tile->center_y - height_scale * 4 + 1);
@@ -246,10 +500,10 @@ static void disp_title(void) {
 }
 
 static void disp_toast(const char *toast) {
-    gfx_SetTextScale(1, 1);
-    const uint8_t base_y = 32;
-    uint24_t width = gfx_GetStringWidth(toast) + 8;
-    uint24_t base_x = (LCD_WIDTH - width) / 2;
+    struct rect rect = get_toast_rect(toast);
+    const uint8_t base_y = rect.y;
+    uint24_t width = rect.width;
+    uint24_t base_x = rect.x;
     gfx_SetColor(COLOR_TEXT);
     gfx_FillRectangle_NoClip(base_x, base_y + 1, width, 14);
     gfx_HorizLine_NoClip(base_x + 1, base_y, width - 2);
@@ -258,7 +512,77 @@ static void disp_toast(const char *toast) {
     gfx_PrintStringXY(toast, base_x + 4, base_y + 4);
 }
 
+#ifndef NDEBUG
+void graphics_toggle_profile(void) {
+    profile_overlay = !profile_overlay;
+    frame_timing.skipped = 0;
+    invalidate_buffers();
+}
+
+// Average for each stage on the left of the board, and minimum and maximum on the right, in thousands of cycles.
+// Below them, the timer ticks the last frame took to draw and how many animation frames have been skipped.
+static void disp_profile(void) {
+    const uint8_t base_y = 62;
+    const uint24_t right_x = LCD_WIDTH - 88;
+    const uint8_t height = 10 * (NUM_PROFILE_STAGES + 2);
+    gfx_SetColor(COLOR_BG);
+    gfx_FillRectangle_NoClip(0, base_y, 92, height);
+    gfx_FillRectangle_NoClip(right_x, base_y, LCD_WIDTH - right_x, height);
+    gfx_SetTextFGColor(COLOR_TEXT);
+    gfx_SetTextScale(1, 1);
+    gfx_PrintStringXY("kc avg", 2, base_y);
+    gfx_PrintStringXY("min max", right_x, base_y);
+    for(uint8_t i = 0; i < NUM_PROFILE_STAGES; i++) {
+        uint8_t y = base_y + 10 * (i + 1);
+        gfx_PrintStringXY(profile_stage_names[i], 2, y);
+        gfx_PrintChar(' ');
+        gfx_PrintUInt(profile_stats[i].avg / 1000, 1);
+        gfx_SetTextXY(right_x, y);
+        gfx_PrintUInt(profile_stats[i].min / 1000, 1);
+        gfx_PrintChar(' ');
+        gfx_PrintUInt(profile_stats[i].max / 1000, 1);
+    }
+    uint8_t y = base_y + 10 * (NUM_PROFILE_STAGES + 1);
+    gfx_PrintStringXY("tck ", 2, y);
+    gfx_PrintUInt(frame_timing.render_ticks, 1);
+    gfx_PrintStringXY("skp ", right_x, y);
+    gfx_PrintUInt(frame_timing.skipped, 1);
+}
+#endif
+
+static void disp_icons(void) {
+    const uint8_t icon_y = LCD_HEIGHT - 22;
+    gfx_RLETSprite_NoClip(icon_help, 1 * LCD_WIDTH / 10 - icon_help_width / 2, icon_y);
+    gfx_RLETSprite_NoClip(icon_stats, 7 * LCD_WIDTH / 10 - icon_stats_width / 2, icon_y);
+    gfx_RLETSprite_NoClip(icon_settings, 9 * LCD_WIDTH / 10 - icon_settings_width / 2, icon_y);
+}
+
+static void disp_words_left(uint16_t words_left) {
+    const uint24_t left = 2 * LCD_WIDTH / 10;
+    const uint24_t right = 6 * LCD_WIDTH / 10;
+    const uint8_t y = LCD_HEIGHT - 15;
+    gfx_SetColor(COLOR_BG);
+    gfx_FillRectangle_NoClip(left, y, right - left, 8);
+    if(!words_left) return;
+
+    char text[] = "00000 words left";
+    char *start = &text[5];
+    uint16_t n = words_left;
+    do {
+        *--start = '0' + n % 10;
+        n /= 10;
+    } while(n);
+    if(words_left == 1) {
+        strcpy(&text[5], " word left");
+    }
+
+    gfx_SetTextScale(1, 1);
+    gfx_SetTextFGColor(COLOR_ICONS);
+    gfx_PrintStringXY(start, (left + right - gfx_GetStringWidth(start)) / 2, y);
+}
+
 void graphics_screen_error(const char *msg[], uint8_t lines) {
+    invalidate_buffers();
     gfx_FillScreen(COLOR_BG);
     disp_title();
     gfx_SetTextFGColor(COLOR_TEXT);
@@ -266,12 +590,13 @@ void graphics_screen_error(const char *msg[], uint8_t lines) {
     for(uint8_t i = 0; i < lines; i++) {
         gfx_PrintStringXY(msg[i], (LCD_WIDTH - gfx_GetStringWidth(msg[i])) / 2, LCD_HEIGHT / 3 + 10 * i);
     }
-    gfx_SwapDraw();
+    swap_buffers();
 }
 
 void graphics_screen_help(void) {
     uint24_t base_x = 4;
 
+    invalidate_buffers();
     gfx_FillScreen(COLOR_BG);
     gfx_SetTextScale(1, 1);
     gfx_SetTextFGColor(COLOR_TEXT);
@@ -347,11 +672,12 @@ void graphics_screen_help(void) {
         }
     }
 
-    gfx_SwapDraw();
+    swap_buffers();
 }
 
 void graphics_screen_stats(uint24_t games_played, uint24_t current_streak, uint24_t max_streak, uint16_t *guess_counts,
-                           uint8_t current_guesses) {
+                           uint8_t current_guesses, const enum tile_type tiles[][WORD_LENGTH]) {
+    invalidate_buffers();
     gfx_FillScreen(COLOR_BG);
     gfx_SetTextFGColor(COLOR_TEXT);
     gfx_SetTextScale(1, 1);
@@ -425,6 +751,16 @@ void graphics_screen_stats(uint24_t games_played, uint24_t current_streak, uint2
         gfx_PrintUInt(guess_counts[i], 1);
     }
 
+    // Miniature of today's board
+    for(uint8_t y = 0; y < current_guesses; y++) {
+        for(uint8_t x = 0; x < WORD_LENGTH; x++) {
+            struct tile tile;
+            get_tile_colors(&tile, tiles[y][x]);
+            gfx_SetColor(tile.bg);
+            gfx_FillRectangle_NoClip(32 + 6 * x, 196 + 6 * y, 5, 5);
+        }
+    }
+
     int hours = 23 - time(NULL) / (60 * 60) % 24;
     int minutes = 59 - time(NULL) / 60 % 60;
     int seconds = 59 - time(NULL) % 60;
@@ -437,7 +773,7 @@ void graphics_screen_stats(uint24_t games_played, uint24_t current_streak, uint2
     gfx_PrintChar(':');
     gfx_PrintUInt(seconds, 2);
 
-    gfx_SwapDraw();
+    swap_buffers();
 }
 
 void disp_toggle(bool state, uint8_t y, bool highlighted) {
@@ -458,6 +794,7 @@ void disp_toggle(bool state, uint8_t y, bool highlighted) {
 }
 
 void graphics_screen_settings(uint8_t settings, uint8_t selection, uint24_t day) {
+    invalidate_buffers();
     gfx_FillScreen(COLOR_BG);
 
     gfx_SetTextScale(1, 1);
@@ -473,13 +810,14 @@ void graphics_screen_settings(uint8_t settings, uint8_t selection, uint24_t day)
             {"Hard Mode", "Must use revealed hints in future guesses"},
             {"Dark Theme", ""},
             {"Color Blind Mode", "High contrast colors"},
+            {"Words Left", "Count answers that fit the hints"},
     };
 
     const uint24_t x = 4;
 
 
     for(uint8_t i = 0; i < sizeof items / sizeof items[0]; i++) {
-        uint8_t y = 50 + 45 * i;
+        uint8_t y = 40 + 45 * i;
         gfx_SetTextFGColor(COLOR_TEXT);
         gfx_SetTextScale(2, 2);
         gfx_PrintStringXY(items[i].text, x, y);
@@ -498,7 +836,7 @@ void graphics_screen_settings(uint8_t settings, uint8_t selection, uint24_t day)
 
     gfx_PrintStringXY(COMMIT, LCD_WIDTH - gfx_GetStringWidth(COMMIT) - 8, LCD_HEIGHT - 10);
 
-    gfx_SwapDraw();
+    swap_buffers();
 }
 
 void graphics_set_palette(uint8_t settings) {
@@ -11,9 +11,17 @@ enum animation {
     ANIM_SUCCESS,
 };
 
+// Animations advance at a fixed rate, driven by timer 1, however long frames take to draw.
+// If drawing falls behind, frames are skipped to keep up.
+#define TIMER_FREQ 32768
+#define ANIM_FPS   30
+#define FRAME_TICKS (TIMER_FREQ / ANIM_FPS)
+
 struct anim_state {
     enum animation animation;
+    // Counts down to 0 when the animation is finished
     uint8_t frame;
+    uint32_t start;
 };
 
 void graphics_init(void);
@@ -21,14 +29,24 @@ void graphics_cleanup(void);
 
 void graphics_set_palette(uint8_t settings);
 
-void graphics_frame(uint8_t cur_line, const char *word, const char guesses[][WORD_LENGTH], const char *toast, struct anim_state *anim_state);
+// Returns true while an animation is playing, and more frames are needed.
+// words_left is shown below the board, unless it's 0.
+bool graphics_frame(uint8_t cur_line, const char guesses[][WORD_LENGTH], const enum tile_type tiles[][WORD_LENGTH], const char *toast, uint16_t words_left, struct anim_state *anim_state);
 
 void graphics_start_anim(struct anim_state *state, enum animation anim);
 
+// Whether the animation has advanced since the last frame was drawn
+bool graphics_frame_due(const struct anim_state *state);
+
+#ifndef NDEBUG
+// Shows or hides the per-stage frame profile
+void graphics_toggle_profile(void);
+#endif
+
 void graphics_screen_error(const char *msg[], uint8_t lines);
 void graphics_screen_help(void);
 void graphics_screen_stats(uint24_t games_played, uint24_t current_streak, uint24_t max_streak, uint16_t *guess_counts,
-                           uint8_t current_guesses);
+                           uint8_t current_guesses, const enum tile_type tiles[][WORD_LENGTH]);
 void graphics_screen_settings(uint8_t settings, uint8_t selection, uint24_t day);
 
 #endif //WORDLE_GRAPHICS_H
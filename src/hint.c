@@ -0,0 +1,267 @@
+#include "hint.h"
+
+#include <string.h>
+
+#include "candidates.h"
+#include "wordlist.h"
+#include "words.h"
+
+// Fractional bits in the fixed point entropy sums
+#define LOG_BITS 8
+
+// Answers filtered or sampled per call
+#define HINT_CHUNK 16
+
+enum hint_state {
+    HINT_IDLE,
+    // Waiting for the candidates to catch up with the board
+    HINT_FILTERING,
+    // Picking out the answers to score guesses against
+    HINT_SAMPLING,
+    // Scoring every guess in the word list
+    HINT_SEARCHING,
+    HINT_DONE,
+};
+
+static const uint8_t *tree;
+
+static enum hint_state state;
+static const struct constraints *hard_constraints;
+
+static char sample[HINT_MAX_ANSWERS][WORD_LENGTH];
+static uint16_t num_sample;
+static uint16_t num_remaining;
+// Answer index during sampling, or guess number during the search
+static uint16_t cursor;
+// Number of remaining answers passed over while sampling
+static uint16_t rank;
+
+static char best[WORD_LENGTH];
+static uint32_t best_cost;
+static bool have_best;
+// Whether best is one of the sampled answers
+static bool best_in_sample;
+
+static uint8_t percent;
+static char text[20];
+
+// log2(n) with LOG_BITS fractional bits, for each bucket size a guess can produce
+static uint16_t log_table[HINT_MAX_ANSWERS + 1];
+static bool log_table_ready;
+
+static uint16_t log2_fixed(uint16_t n) {
+    uint8_t whole = 0;
+    while(n >> (whole + 1)) whole++;
+    // n / 2^whole, in [1, 2) with 15 fractional bits
+    uint32_t x = (uint32_t)n << 15 >> whole;
+    uint16_t result = whole << LOG_BITS;
+    for(uint8_t bit = 1 << (LOG_BITS - 1); bit; bit >>= 1) {
+        x = x * x >> 15;
+        if(x >= (uint32_t)2 << 15) {
+            x >>= 1;
+            result |= bit;
+        }
+    }
+    return result;
+}
+
+static void set_text(void) {
+    if(state == HINT_DONE) {
+        if(have_best) {
+            strcpy(text, "Try _____");
+            memcpy(&text[4], best, WORD_LENGTH);
+        } else {
+            strcpy(text, "No words fit");
+        }
+    } else {
+        strcpy(text, "Thinking... ");
+        char *end = &text[strlen(text)];
+        if(percent >= 10) *end++ = '0' + percent / 10;
+        *end++ = '0' + percent % 10;
+        strcpy(end, "%");
+    }
+}
+
+static uint16_t read_u16(const uint8_t *ptr) {
+    return ptr[0] | ptr[1] << 8;
+}
+
+bool hint_init(const void *appvar_data) {
+    const struct hints_header *header = (const void*)((const uint8_t*)appvar_data + 2);
+    tree = NULL;
+    if(memcmp(header->magic, HINTS_MAGIC, sizeof header->magic) != 0) return false;
+    if(header->version != HINTS_VERSION) return false;
+    if(header->num_words != num_words) return false;
+    tree = (const uint8_t*)(header + 1);
+    return true;
+}
+
+// Follows the rows down the tree, one child lookup per row. Returns false if they leave it.
+static bool walk_tree(const char guesses[][WORD_LENGTH], const enum tile_type tiles[][WORD_LENGTH], uint8_t num_rows,
+                      char *guess) {
+    if(!tree) return false;
+    uint16_t next = 0;
+    for(uint8_t row = 0; row < num_rows; row++) {
+        if(next & HINTS_LEAF) return false;
+        const uint8_t *node = &tree[next];
+        wordlist_get(read_u16(node), guess);
+        if(memcmp(guess, guesses[row], WORD_LENGTH) != 0) return false;
+
+        uint8_t score = encode_score(tiles[row]);
+        const uint8_t *children = node + 3;
+        uint8_t min = 0;
+        uint8_t max = node[2];
+        while(min < max) {
+            uint8_t mean = (min + max) / 2;
+            if(children[3 * mean] < score) min = mean + 1;
+            else max = mean;
+        }
+        if(min == node[2] || children[3 * min] != score) return false;
+        next = read_u16(&children[3 * min + 1]);
+    }
+    wordlist_get(next & HINTS_LEAF ? next & ~HINTS_LEAF : read_u16(&tree[next]), guess);
+    return true;
+}
+
+void hint_start(const char guesses[][WORD_LENGTH], const enum tile_type tiles[][WORD_LENGTH], uint8_t num_rows,
+                const struct constraints *constraints) {
+    if(!log_table_ready) {
+        for(uint16_t n = 1; n <= HINT_MAX_ANSWERS; n++) {
+            log_table[n] = log2_fixed(n);
+        }
+        log_table_ready = true;
+    }
+    hard_constraints = constraints;
+    percent = 0;
+    have_best = walk_tree(guesses, tiles, num_rows, best) && (!constraints || constraints_allow(constraints, best));
+    state = have_best ? HINT_DONE : HINT_FILTERING;
+    set_text();
+}
+
+void hint_cancel(void) {
+    state = HINT_IDLE;
+}
+
+bool hint_started(void) {
+    return state != HINT_IDLE;
+}
+
+bool hint_running(void) {
+    return state != HINT_IDLE && state != HINT_DONE;
+}
+
+// Sum of n log2 n over the feedback buckets. The entropy of the feedback is log2 N - cost / N, so the guess with the
+// lowest cost has the highest entropy.
+static uint32_t score_cost(const char *guess) {
+    static uint16_t buckets[NUM_SCORES];
+    memset(buckets, 0, sizeof buckets);
+    for(uint16_t i = 0; i < num_sample; i++) {
+        buckets[score_guess(guess, sample[i])]++;
+    }
+    uint32_t cost = 0;
+    for(uint8_t i = 0; i < NUM_SCORES; i++) {
+        cost += (uint32_t)buckets[i] * log_table[buckets[i]];
+    }
+    return cost;
+}
+
+static bool in_sample(const char *guess) {
+    for(uint16_t i = 0; i < num_sample; i++) {
+        if(memcmp(guess, sample[i], WORD_LENGTH) == 0) return true;
+    }
+    return false;
+}
+
+static bool update_search(void) {
+    uint24_t total = num_words;
+    char guess[WORD_LENGTH];
+    wordlist_get(cursor++, guess);
+
+    if(!hard_constraints || constraints_allow(hard_constraints, guess)) {
+        uint32_t cost = score_cost(guess);
+        if(!have_best || cost < best_cost) {
+            memcpy(best, guess, WORD_LENGTH);
+            best_cost = cost;
+            best_in_sample = in_sample(guess);
+            have_best = true;
+        } else if(cost == best_cost && !best_in_sample && in_sample(guess)) {
+            // Just as good a split, with a chance of being right straight away
+            memcpy(best, guess, WORD_LENGTH);
+            best_in_sample = true;
+        }
+    }
+
+    if(cursor == total) {
+        state = HINT_DONE;
+        set_text();
+        return true;
+    }
+    uint8_t new_percent = (uint24_t)cursor * 100 / total;
+    if(new_percent != percent) {
+        percent = new_percent;
+        set_text();
+        return true;
+    }
+    return false;
+}
+
+bool hint_update(void) {
+    switch(state) {
+        case HINT_FILTERING: {
+            candidates_update(HINT_CHUNK);
+            if(!candidates_pending()) {
+                num_remaining = candidates_count();
+                num_sample = 0;
+                cursor = 0;
+                rank = 0;
+                state = HINT_SAMPLING;
+            }
+            return false;
+        }
+        case HINT_SAMPLING: {
+            for(uint8_t i = 0; i < HINT_CHUNK && num_sample < num_remaining && num_sample < HINT_MAX_ANSWERS; i++, cursor++) {
+                // There's always another one, since fewer than num_remaining have been seen
+                cursor = candidates_next(cursor);
+                // Takes exactly HINT_MAX_ANSWERS of the remaining answers, spread evenly through them
+                uint32_t before = (uint32_t)rank * HINT_MAX_ANSWERS / num_remaining;
+                uint32_t after = (uint32_t)(rank + 1) * HINT_MAX_ANSWERS / num_remaining;
+                rank++;
+                if(after != before) {
+                    get_answer(cursor, sample[num_sample++]);
+                }
+            }
+            if(num_sample == num_remaining || num_sample == HINT_MAX_ANSWERS) {
+                cursor = 0;
+                if(num_remaining <= 2) {
+                    // Nothing can do better than guessing one of them
+                    if(num_remaining) {
+                        memcpy(best, sample[0], WORD_LENGTH);
+                        have_best = true;
+                    }
+                    state = HINT_DONE;
+                    set_text();
+                    return true;
+                }
+                state = HINT_SEARCHING;
+            }
+            return false;
+        }
+        case HINT_SEARCHING: {
+            return update_search();
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void hint_finish(void) {
+    if(hint_running() && have_best) {
+        state = HINT_DONE;
+        set_text();
+    }
+}
+
+const char *hint_text(void) {
+    return text;
+}
@@ -0,0 +1,60 @@
+#ifndef WORDLE_HINT_H
+#define WORDLE_HINT_H
+
+#include "wordle.h"
+#include "constraints.h"
+
+// Suggests the guess that splits the remaining answers up the most, by the entropy of the feedback it would get.
+// The search runs as a job that does a small slice of work per call to hint_update, so that it can be spread out over
+// frames. Ties go to a guess that could be the answer, and then to whichever comes first in the word list, so the
+// suggestion for a given board is always the same.
+
+// The HINTS appvar: this header followed by a decision tree, root node first. tools/mkhints.py builds a greedy tree,
+// and host/optimal one with the fewest guesses in total, in the same format. A node is a uint16_t word list index of
+// the guess to make, then a uint8_t count of children, then a child for each feedback the guess can get other than all
+// correct, sorted by score. A child is a uint8_t score and a uint16_t that is either the offset of the child's node
+// from the root, or HINTS_LEAF | the word list index of the only answer left.
+struct hints_header {
+    char magic[3];
+    uint8_t version;
+    // num_words of the WORDS appvar the guess and leaf indices in the tree were built against; hint_init ignores a
+    // tree built for any other
+    uint16_t num_words;
+};
+
+#define HINTS_MAGIC "HNT"
+#define HINTS_VERSION 1
+#define HINTS_LEAF 0x8000
+
+// The answers that guesses are scored against. If there are more remaining, an evenly spaced selection is used.
+#define HINT_MAX_ANSWERS 512
+
+// Loads the optional HINTS appvar. Must be called after wordlist_init. Returns false if the appvar is in an unknown
+// format or doesn't match the word list, in which case hints are always searched for.
+bool hint_init(const void *appvar_data);
+
+// Starts looking for a guess to follow the submitted rows, which must also have been added to the candidates.
+// While the rows follow the HINTS tree, the suggestion is found straight away, otherwise it's searched for.
+// If constraints is not NULL, only guesses that it allows are suggested.
+void hint_start(const char guesses[][WORD_LENGTH], const enum tile_type tiles[][WORD_LENGTH], uint8_t num_rows,
+                const struct constraints *constraints);
+
+// Forgets any search, for when the board changes
+void hint_cancel(void);
+
+// Whether hint_start has been called since the last hint_cancel
+bool hint_started(void);
+
+// Whether the search still has work left to do
+bool hint_running(void);
+
+// Does a slice of the search. Returns true if hint_text has changed.
+bool hint_update(void);
+
+// Ends the search early with the best guess found so far, if there is one
+void hint_finish(void);
+
+// Progress of the search, or the suggestion once it's done
+const char *hint_text(void);
+
+#endif //WORDLE_HINT_H
@@ -0,0 +1,63 @@
+#include "input.h"
+
+#include <keypadc.h>
+
+#define NUM_GROUPS 7
+// Enough for a whole guess and the next one to be typed while the board is still flipping
+#define PENDING_LENGTH 16
+
+static uint8_t prev_state[NUM_GROUPS];
+
+static sk_key_t pending[PENDING_LENGTH];
+static uint8_t pending_start;
+static uint8_t pending_count;
+
+static void read_state(uint8_t *state) {
+    for(uint8_t group = 0; group < NUM_GROUPS; group++) {
+        state[group] = kb_Data[group + 1];
+    }
+}
+
+void input_init(void) {
+    // The hardware keeps kb_Data up to date on its own, so reading it doesn't have to wait for a scan
+    kb_SetMode(MODE_3_CONTINUOUS);
+    // Keys that are already held, like the enter key used to start the program, shouldn't count as presses
+    read_state(prev_state);
+    pending_count = 0;
+}
+
+void input_cleanup(void) {
+    kb_Reset();
+}
+
+void input_poll(void) {
+    uint8_t state[NUM_GROUPS];
+    read_state(state);
+    for(uint8_t group = 0; group < NUM_GROUPS; group++) {
+        uint8_t pressed = state[group] & ~prev_state[group];
+        prev_state[group] = state[group];
+        for(uint8_t bit = 0; pressed; bit++, pressed >>= 1) {
+            if(!(pressed & 1) || pending_count == PENDING_LENGTH) continue;
+            // Same numbering as the OS uses for os_GetCSC
+            sk_key_t key = (NUM_GROUPS - 1 - group) * 8 + bit + 1;
+            pending[(pending_start + pending_count) % PENDING_LENGTH] = key;
+            pending_count++;
+        }
+    }
+}
+
+bool input_queued(sk_key_t key) {
+    for(uint8_t i = 0; i < pending_count; i++) {
+        if(pending[(pending_start + i) % PENDING_LENGTH] == key) return true;
+    }
+    return false;
+}
+
+sk_key_t input_get_key(void) {
+    input_poll();
+    if(!pending_count) return 0;
+    sk_key_t key = pending[pending_start];
+    pending_start = (pending_start + 1) % PENDING_LENGTH;
+    pending_count--;
+    return key;
+}
@@ -0,0 +1,23 @@
+#ifndef WORDLE_INPUT_H
+#define WORDLE_INPUT_H
+
+#include <tice.h>
+
+// Reads the keypad directly rather than through os_GetCSC, so that presses are noticed whenever input_poll is called,
+// including part way through drawing a frame, and several presses between calls are all kept.
+// Keys are reported with the same scan codes as os_GetCSC.
+
+void input_init(void);
+void input_cleanup(void);
+
+// Records any keys that have been pressed since the last poll.
+// Once PENDING_LENGTH keys are waiting, any more presses are dropped until some have been read.
+void input_poll(void);
+
+// Whether the key has been pressed and is still waiting to be returned by input_get_key
+bool input_queued(sk_key_t key);
+
+// Polls, then returns the oldest key pressed that hasn't been returned yet, or 0 if there are none
+sk_key_t input_get_key(void);
+
+#endif //WORDLE_INPUT_H
@@ -4,6 +4,12 @@
 #include <debug.h>
 #include "graphics.h"
 #include "words.h"
+#include "wordlist.h"
+#include "profile.h"
+#include "input.h"
+#include "candidates.h"
+#include "hint.h"
+#include "game.h"
 
 /*
  *--------------------------------------
@@ -14,123 +20,42 @@
  *--------------------------------------
 */
 
-const char (*words)[WORD_LENGTH];
-uint16_t num_words;
-
-enum tile_type get_tile_type(const char guesses[][WORD_LENGTH], uint8_t guess, uint8_t pos, const char *word, uint8_t num_guesses) {
-    char c = guesses[guess][pos];
-    if(!c) {
-        return TILE_EMPTY;
-    } else if(guess == num_guesses) {
-        return TILE_UNSUBMITTED;
-    } else if(c == word[pos]) {
-        return TILE_CORRECT;
-    } else {
-        // Count occurrences in answer
-        uint8_t count_answer = 0;
-        uint8_t count_correct = 0;
-        for(uint8_t i = 0; i < WORD_LENGTH; i++) {
-            if(c == word[i]) {
-                count_answer++;
-                if(guesses[guess][i] == word[i]) {
-                    count_correct++;
-                }
-            }
-        }
-        // Count how many tiles with this letter have already been shown as present or correct
-        uint8_t count_prev = 0;
-        for(uint8_t i = 0; i < pos; i++) {
-            if(c == guesses[guess][i]) {
-                count_prev++;
-            }
-        }
-        // Only mark present if there are fewer of this character already marked than there are in the answer
-        if(count_answer - count_correct > count_prev) return TILE_PRESENT;
-        else return TILE_ABSENT;
-    }
-}
-
-bool is_word_in_list(const char *word) {
-    int min = 0;
-    int max = num_words;
-    while(min <= max) {
-        int mean = (min + max) / 2;
-        int diff = memcmp(words[mean], word, WORD_LENGTH);
-        if(diff < 0) min = mean + 1;
-        else if(diff > 0) max = mean - 1;
-        else return true;
-    }
-    return false;
+// Sleeps until the next interrupt rather than spinning - the OS's timer interrupts wake it often enough for the
+// keypad to be polled without a noticeable delay
+void idle(void) {
+    asm("halt");
 }
 
-const char *validate_word(const char guesses[][WORD_LENGTH], const char *word, uint8_t cur_guess, uint8_t settings) {
-    const char *guess = guesses[cur_guess];
-    if(strnlen(guess, 5) != 5) return "Not enough letters";
-    if(!is_word_in_list(guess)) return "Not in word list";
-
-    if(settings & SETTING_HARD && cur_guess > 0) {
-        const char *prev_guess = guesses[cur_guess - 1];
-        static char text_position[] = "___ letter must be _";
-        dbg_printf("hard mode\n");
-        for(uint8_t i = 0; i < WORD_LENGTH; i++) {
-            const char ordinals[WORD_LENGTH][3] = {"1st", "2nd", "3rd", "4th", "5th"};
-            if(guess[i] != prev_guess[i] && get_tile_type(guesses, cur_guess - 1, i, word, cur_guess) == TILE_CORRECT) {
-                memcpy(text_position, ordinals[i], 3);
-                text_position[19] = prev_guess[i];
-                return text_position;
-            }
-        }
-        static char text_contains[] = "Guess must contain _";
-        for(uint8_t i = 0; i < WORD_LENGTH; i++) {
-            if(get_tile_type(guesses, cur_guess - 1, i, word, cur_guess) != TILE_PRESENT) {
-                continue;
-            }
-            bool found = false;
-            for(uint8_t j = 0; j < WORD_LENGTH; j++) {
-                if(guess[j] == prev_guess[i]) {
-                    found = true;
-                    break;
-                }
-            }
-            if(!found) {
-                text_contains[19] = prev_guess[i];
-                return text_contains;
-            }
-        }
-        return NULL;
-    } else {
-        return NULL;
+sk_key_t wait_for_key(void) {
+    sk_key_t key;
+    while(!(key = input_get_key())) {
+        idle();
     }
-}
-
-int get_day_number(void) {
-    time_t current = time(NULL);
-    time_t start = 1624060800;
-    return (long)(current - start) / (60 * 60 * 24);
+    return key;
 }
 
 void screen_help(void) {
-    do {
-        graphics_screen_help();
-    } while(!os_GetCSC());
+    graphics_screen_help();
+    wait_for_key();
 }
 
 void screen_settings(uint8_t *settings, uint24_t day) {
     int8_t selection = 0;
     sk_key_t key;
+    graphics_screen_settings(*settings, selection, day);
     do {
-        key = os_GetCSC();
+        key = wait_for_key();
         switch (key) {
             case sk_Up: {
                 selection--;
                 if(selection < 0) {
-                    selection = 2;
+                    selection = NUM_SETTINGS - 1;
                 }
                 break;
             }
             case sk_Down: {
                 selection++;
-                if(selection >= 3) {
+                if(selection >= NUM_SETTINGS) {
                     selection = 0;
                 }
                 break;
@@ -147,19 +72,20 @@ void screen_settings(uint8_t *settings, uint24_t day) {
     } while(key != sk_Clear);
 }
 
+// Answers checked between each check for a new frame or key
+#define CANDIDATES_CHUNK 16
+
+// Keys typed while the board is flipping are applied in order once it's done, rather than while rows are changing
+static bool defers_input(enum animation animation) {
+    return animation == ANIM_FLIP_ALL || animation == ANIM_FLIP_LINE || animation == ANIM_SUCCESS;
+}
+
 void play_game(int day) {
     struct save save = {};
 
     FILE *f = fopen("WORDLE", "r");
     if(f) {
         fread(&save, sizeof save, 1, f);
-        if(save.day != day) {
-            if(save.day != day - 1) {
-                save.current_streak = 0;
-            }
-            memset(save.guesses, 0, sizeof save.guesses);
-            save.num_guesses = 0;
-        }
         fclose(f);
         f = NULL;
     } else {
@@ -176,68 +102,68 @@ void play_game(int day) {
     dbg_printf("played: %u\n", save.games_played);
     dbg_printf("guesses: %.30s\n", *save.guesses);
 
-    save.day = day;
+    save_start_day(&save, day);
+
+    char word[WORD_LENGTH + 1] = {0};
+    get_answer(day, word);
+
+    struct game game;
+    game_start(&game, &save, word);
 
-    const char *word = answers[day];
-    uint8_t input_index = strnlen(save.guesses[save.num_guesses], WORD_LENGTH);
     struct anim_state anim_state;
-    bool completed = save.num_guesses == MAX_GUESSES || (save.num_guesses && memcmp(save.guesses[save.num_guesses - 1], word, WORD_LENGTH) == 0);
     const char *toast = NULL;
 
     graphics_start_anim(&anim_state, ANIM_FLIP_ALL);
+    bool animating = true;
 
     sk_key_t key;
-    while ((key = os_GetCSC()) != sk_Clear) {
-        switch (key) {
-            case sk_Enter: {
-                if(!completed) {
-                    if(memcmp(save.guesses[save.num_guesses], word, WORD_LENGTH) == 0) {
-                        // Guess matches word
-                        save.games_played++;
-                        save.guess_counts[save.num_guesses]++;
-                        save.current_streak++;
-                        if(save.current_streak > save.max_streak) {
-                            save.max_streak = save.current_streak;
-                        }
-                        save.num_guesses++;
-                        input_index = 0;
-                        graphics_start_anim(&anim_state, ANIM_SUCCESS);
-                        completed = true;
-                        static const char *results[] = {
-                                "Genius",
-                                "Magnificent",
-                                "Impressive",
-                                "Splendid",
-                                "Great",
-                                "Phew",
-                        };
-                        toast = results[save.num_guesses - 1];
-                    } else if(!(toast = validate_word(save.guesses, word, save.num_guesses,  save.settings))) {
-                        // Guess is valid word that's not today's
-                        save.num_guesses++;
-                        input_index = 0;
-                        graphics_start_anim(&anim_state, ANIM_FLIP_LINE);
-                        if(save.num_guesses == MAX_GUESSES) {
-                            // Game is lost
-                            completed = true;
-                            save.games_played++;
-                            save.current_streak = 0;
-                            toast = word;
-                        }
-                    } else {
-                        // Word is invalid
-                        graphics_start_anim(&anim_state, ANIM_INVALID_WORD);
-                    }
+    while (true) {
+        if(animating && defers_input(anim_state.animation)) {
+            // Leave keys in the queue until the board stops moving, except for quitting
+            input_poll();
+            key = input_queued(sk_Clear) ? sk_Clear : 0;
+        } else {
+            key = input_get_key();
+        }
+        if(key == sk_Clear) break;
+
+        if(!key) {
+            // Background work is done a slice at a time, so that animations and input aren't held up by it
+            bool changed = false;
+            uint16_t words_left = candidates_count();
+            if(hint_running()) {
+                // Progress replaces the toast, unless something else is being shown there
+                if(hint_update() && (!toast || toast == hint_text())) {
+                    toast = hint_text();
+                    changed = true;
                 }
-                break;
+            } else if(save.settings & SETTING_COUNTER && candidates_pending()) {
+                candidates_update(CANDIDATES_CHUNK);
+            } else if(!animating) {
+                // Nothing on the board can change until there's input
+                idle();
+                continue;
+            }
+            // The counter only changes once every answer has been checked
+            if(save.settings & SETTING_COUNTER && candidates_count() != words_left) {
+                changed = true;
             }
+            // Animations run at a fixed rate, so there's nothing new to draw until the next step
+            if(!changed && !(animating && graphics_frame_due(&anim_state))) {
+                continue;
+            }
+        }
 
-            case sk_Del: {
-                if(input_index > 0 && !completed) {
-                    input_index--;
-                    save.guesses[save.num_guesses][input_index] = 0;
-                    toast = NULL;
+        switch (key) {
+            case sk_Window: {
+                if(game.completed) break;
+                if(!hint_started()) {
+                    hint_start(save.guesses, game.tiles, save.num_guesses, save.settings & SETTING_HARD ? &game.constraints : NULL);
+                } else {
+                    // Asking again gives the best guess so far
+                    hint_finish();
                 }
+                toast = hint_text();
                 break;
             }
 
@@ -247,10 +173,18 @@ void play_game(int day) {
             }
 
             case sk_Trace: {
+                // Only the countdown changes, once a second
+                time_t shown = 0;
                 do {
-                    graphics_screen_stats(save.games_played, save.current_streak, save.max_streak, save.guess_counts,
-                                          completed ? save.num_guesses : 0);
-                } while(!os_GetCSC());
+                    time_t now = time(NULL);
+                    if(now != shown) {
+                        graphics_screen_stats(save.games_played, save.current_streak, save.max_streak, save.guess_counts,
+                                              game.completed ? save.num_guesses : 0, game.tiles);
+                        shown = now;
+                    } else {
+                        idle();
+                    }
+                } while(!input_get_key());
                 break;
             }
 
@@ -259,17 +193,52 @@ void play_game(int day) {
                 break;
             }
 
+#ifndef NDEBUG
+            case sk_Mode: {
+                graphics_toggle_profile();
+                break;
+            }
+#endif
+
             default: {
-                const char *chars = "\0\0\0\0\0\0\0\0\0\0\0WRMH\0\0\0\0VQLG\0\0\0ZUPKFC\0\0YTOJEB\0\0XSNIDA\0\0\0\0\0\0\0\0";
-                if(chars[key] && input_index < WORD_LENGTH && !completed) {
-                    save.guesses[save.num_guesses][input_index] = chars[key];
-                    input_index++;
-                    graphics_start_anim(&anim_state, ANIM_TYPE_LETTER);
+                switch(game_key(&game, key)) {
+                    case GAME_TYPED: {
+                        graphics_start_anim(&anim_state, ANIM_TYPE_LETTER);
+                        break;
+                    }
+                    case GAME_DELETED: {
+                        toast = NULL;
+                        break;
+                    }
+                    case GAME_INVALID: {
+                        toast = game.message;
+                        graphics_start_anim(&anim_state, ANIM_INVALID_WORD);
+                        break;
+                    }
+                    case GAME_SUBMITTED: {
+                        toast = NULL;
+                        graphics_start_anim(&anim_state, ANIM_FLIP_LINE);
+                        break;
+                    }
+                    case GAME_WON: {
+                        toast = game.message;
+                        graphics_start_anim(&anim_state, ANIM_SUCCESS);
+                        break;
+                    }
+                    case GAME_LOST: {
+                        toast = game.message;
+                        graphics_start_anim(&anim_state, ANIM_FLIP_LINE);
+                        break;
+                    }
+                    case GAME_NONE: {
+                        break;
+                    }
                 }
             }
         }
 
-        graphics_frame(save.num_guesses, word, save.guesses, toast, &anim_state);
+        uint16_t words_left = save.settings & SETTING_COUNTER ? candidates_count() : 0;
+        animating = graphics_frame(save.num_guesses, save.guesses, game.tiles, toast, words_left, &anim_state);
     }
 
     f = fopen("WORDLE", "w");
@@ -280,62 +249,90 @@ void play_game(int day) {
     } else {
         dbg_printf("write fopen failed\n");
     }
+
+    profile_dump();
 }
 
 void error_set_time(void) {
-    do {
-        const char *msg[] = {
-                "Before playing, please set",
-                "the system clock to today's",
-                "date from the mode menu.",
-        };
-        graphics_screen_error(msg, 3);
-    } while(os_GetCSC() != sk_Clear);
+    const char *msg[] = {
+            "Before playing, please set",
+            "the system clock to today's",
+            "date from the mode menu.",
+    };
+    graphics_screen_error(msg, 3);
+    while(wait_for_key() != sk_Clear);
 }
 
 void error_no_puzzle(void) {
-    do {
-        const char *msg[] = {
-                "We've somehow run out of puzzles.",
-                "",
-                "Sorry about that, inhabitant",
-                "of the far future."
-        };
-        graphics_screen_error(msg, 4);
-    } while(os_GetCSC() != sk_Clear);
+    const char *msg[] = {
+            "We've somehow run out of puzzles.",
+            "",
+            "Sorry about that, inhabitant",
+            "of the far future."
+    };
+    graphics_screen_error(msg, 4);
+    while(wait_for_key() != sk_Clear);
 }
 
 void error_no_appvar(void) {
-    do {
-        const char *msg[] = {
-                "Word list not found.",
-                "Please resend WORDS.8xv.",
-        };
-        graphics_screen_error(msg, 2);
-    } while(os_GetCSC() != sk_Clear);
+    const char *msg[] = {
+            "Word list not found.",
+            "Please resend WORDS.8xv.",
+    };
+    graphics_screen_error(msg, 2);
+    while(wait_for_key() != sk_Clear);
+}
+
+void error_no_answers(void) {
+    const char *msg[] = {
+            "Answer list not found or doesn't",
+            "match the word list.",
+            "Please resend ANSWERS.8xv.",
+    };
+    graphics_screen_error(msg, 3);
+    while(wait_for_key() != sk_Clear);
+}
+
+void error_bad_appvar(void) {
+    const char *msg[] = {
+            "Word list format not supported.",
+            "Please resend WORDS.8xv.",
+    };
+    graphics_screen_error(msg, 2);
+    while(wait_for_key() != sk_Clear);
 }
 
 int main(void) {
     graphics_init();
+    input_init();
 
-    int day = get_day_number();
+    int day = get_day_number(time(NULL));
     dbg_printf("WORDLE: day %i\n", day);
 
     void *appvar_data = os_GetAppVarData("WORDS", NULL);
+    void *answers_data = os_GetAppVarData("ANSWERS", NULL);
+    void *hints_data = os_GetAppVarData("HINTS", NULL);
 
     if(!appvar_data) {
         error_no_appvar();
+    } else if(!wordlist_init(appvar_data)) {
+        error_bad_appvar();
+    } else if(!answers_data || !answers_init(answers_data)) {
+        error_no_answers();
     } else if(day < 0) {
         error_set_time();
     } else if(day >= num_answers) {
         error_no_puzzle();
     } else {
-        words = appvar_data + 2;
-        num_words = *((uint16_t*)appvar_data) / WORD_LENGTH;
-        dbg_printf("found %u words, starting with %.5s\n", num_words, words[0]);
+        dbg_printf("found %u words\n", num_words);
+        // Hints are searched for on the calculator without it, so it isn't an error for it to be missing
+        if(hints_data && !hint_init(hints_data)) {
+            dbg_printf("ignoring mismatched HINTS appvar\n");
+        }
         play_game(day);
     }
 
+    input_cleanup();
     graphics_cleanup();
     return 0;
 }
@@ -0,0 +1,87 @@
+#include "profile.h"
+
+#ifndef NDEBUG
+
+#include <string.h>
+#include <stdio.h>
+#include <tice.h>
+#include <debug.h>
+
+const char *const profile_stage_names[NUM_PROFILE_STAGES] = {
+        [PROFILE_CLEAR]   = "clr",
+        [PROFILE_TITLE]   = "ttl",
+        [PROFILE_TOAST]   = "tst",
+        [PROFILE_SCORING] = "scr",
+        [PROFILE_TILES]   = "til",
+        [PROFILE_ICONS]   = "icn",
+        [PROFILE_SWAP]    = "swp",
+        [PROFILE_FRAME]   = "frm",
+};
+
+struct profile_stats profile_stats[NUM_PROFILE_STAGES];
+bool profile_overlay;
+
+// Cycle counts of the last PROFILE_WINDOW frames, oldest at history_next once it has filled up
+static uint32_t history[NUM_PROFILE_STAGES][PROFILE_WINDOW];
+static uint32_t frame_cycles[NUM_PROFILE_STAGES];
+static uint8_t history_next;
+static uint8_t history_frames;
+static uint32_t frame_start;
+static uint32_t last_mark;
+
+void profile_init(void) {
+    // Timer 2 counts CPU cycles, since timer 1's 32 kHz is too coarse for a single stage
+    timer_Enable(2, TIMER_CPU, TIMER_NOINT, TIMER_UP);
+    timer_Set(2, 0);
+}
+
+void profile_begin_frame(void) {
+    memset(frame_cycles, 0, sizeof frame_cycles);
+    frame_start = last_mark = timer_Get(2);
+}
+
+void profile_mark(enum profile_stage stage) {
+    uint32_t now = timer_Get(2);
+    frame_cycles[stage] += now - last_mark;
+    last_mark = now;
+}
+
+void profile_end_frame(void) {
+    frame_cycles[PROFILE_FRAME] = timer_Get(2) - frame_start;
+
+    for(uint8_t i = 0; i < NUM_PROFILE_STAGES; i++) {
+        history[i][history_next] = frame_cycles[i];
+    }
+    history_next = (history_next + 1) % PROFILE_WINDOW;
+    if(history_frames < PROFILE_WINDOW) history_frames++;
+
+    for(uint8_t i = 0; i < NUM_PROFILE_STAGES; i++) {
+        struct profile_stats *stats = &profile_stats[i];
+        uint32_t total = 0;
+        stats->min = stats->max = history[i][0];
+        for(uint8_t f = 0; f < history_frames; f++) {
+            uint32_t cycles = history[i][f];
+            if(cycles < stats->min) stats->min = cycles;
+            if(cycles > stats->max) stats->max = cycles;
+            total += cycles;
+        }
+        stats->avg = total / history_frames;
+        // Logged once a window, so as not to flood the console
+        if(profile_overlay && !history_next) {
+            dbg_printf("%s min %lu avg %lu max %lu\n", profile_stage_names[i], (unsigned long)stats->min,
+                       (unsigned long)stats->avg, (unsigned long)stats->max);
+        }
+    }
+}
+
+void profile_dump(void) {
+    FILE *f = fopen("WORDPROF", "w");
+    if(f) {
+        fwrite(profile_stats, sizeof profile_stats, 1, f);
+        fclose(f);
+    } else {
+        dbg_printf("profile fopen failed\n");
+    }
+}
+
+#endif
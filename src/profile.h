@@ -0,0 +1,55 @@
+#ifndef WORDLE_PROFILE_H
+#define WORDLE_PROFILE_H
+
+#include "wordle.h"
+
+// Per-stage CPU cycle counts for graphics_frame, only compiled into debug builds
+
+enum profile_stage {
+    PROFILE_CLEAR,
+    PROFILE_TITLE,
+    PROFILE_TOAST,
+    PROFILE_SCORING,
+    PROFILE_TILES,
+    PROFILE_ICONS,
+    PROFILE_SWAP,
+    // Whole frame
+    PROFILE_FRAME,
+    NUM_PROFILE_STAGES,
+};
+
+// Stats cover the last this many frames drawn, and are updated after every frame
+#define PROFILE_WINDOW 32
+
+struct profile_stats {
+    uint32_t min;
+    uint32_t avg;
+    uint32_t max;
+};
+
+#ifndef NDEBUG
+
+extern const char *const profile_stage_names[NUM_PROFILE_STAGES];
+extern struct profile_stats profile_stats[NUM_PROFILE_STAGES];
+// Show the stats on screen and log them to the debug console
+extern bool profile_overlay;
+
+void profile_init(void);
+void profile_begin_frame(void);
+// Attributes the cycles since the last mark to a stage
+void profile_mark(enum profile_stage stage);
+void profile_end_frame(void);
+// Writes the latest stats to the WORDPROF appvar
+void profile_dump(void);
+
+#else
+
+#define profile_init()
+#define profile_begin_frame()
+#define profile_mark(stage)
+#define profile_end_frame()
+#define profile_dump()
+
+#endif
+
+#endif //WORDLE_PROFILE_H
@@ -4,12 +4,25 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifdef WORDLE_HOST
+// The eZ80's native int, which other compilers don't have
+typedef uint32_t uint24_t;
+typedef int32_t int24_t;
+#endif
+
 #define WORD_LENGTH 5
 #define MAX_GUESSES 6
 
+// Feedback for a row packed as base 3 digits, first tile in the least significant digit:
+// 0 for absent, 1 for present and 2 for correct
+#define NUM_SCORES    243
+#define SCORE_CORRECT 242
+
 #define SETTING_HARD     (1 << 0)
 #define SETTING_DARK     (1 << 1)
 #define SETTING_CONTRAST (1 << 2)
+#define SETTING_COUNTER  (1 << 3)
+#define NUM_SETTINGS 4
 
 struct save {
     uint16_t day;
@@ -31,5 +44,9 @@ enum tile_type {
 };
 
 enum tile_type get_tile_type(const char guesses[][WORD_LENGTH], uint8_t guess, uint8_t pos, const char *word, uint8_t num_guesses);
+uint8_t score_guess(const char *guess, const char *answer);
+void decode_score(uint8_t score, enum tile_type tiles[WORD_LENGTH]);
+uint8_t encode_score(const enum tile_type tiles[WORD_LENGTH]);
+void score_row(enum tile_type tiles[WORD_LENGTH], const char guesses[][WORD_LENGTH], uint8_t guess, const char *word);
 
 #endif //WORDLE_WORDLE_H
@@ -0,0 +1,233 @@
+#include "wordlist.h"
+
+#include <string.h>
+
+#define NUM_LETTERS 26
+#define NUM_BUCKETS (NUM_LETTERS * NUM_LETTERS)
+
+#define DAWG_LAST_EDGE 0x80
+#define DAWG_LETTER    0x1f
+
+uint16_t num_words;
+
+static const char (*plain_words)[WORD_LENGTH];
+static const uint16_t *packed_words;
+static const uint8_t *dawg;
+
+// Index of the first word starting with each two letter prefix, so that lookups only have to search one bucket.
+// Packed appvars ship this in their header, otherwise it's built on startup.
+static uint16_t plain_index[NUM_BUCKETS + 1];
+static const uint16_t *prefix_index;
+
+static uint16_t get_bucket(const char *word) {
+    return (word[0] - 'A') * NUM_LETTERS + word[1] - 'A';
+}
+
+// Letters after the bucket prefix, packed the same way as in WORDLIST_PACKED
+static uint16_t pack_suffix(const char *word) {
+    return (word[2] - 'A') << 10 | (word[3] - 'A') << 5 | (word[4] - 'A');
+}
+
+static uint16_t get_key(uint16_t index) {
+    if(packed_words) return packed_words[index];
+    return pack_suffix(plain_words[index]);
+}
+
+static uint16_t read_u16(const uint8_t *ptr) {
+    return ptr[0] | ptr[1] << 8;
+}
+
+static uint8_t dawg_edge_size(uint8_t depth) {
+    return depth == WORD_LENGTH - 1 ? 1 : 3;
+}
+
+static uint16_t dawg_edge_count(const uint8_t *edge, uint8_t depth) {
+    if(depth == WORD_LENGTH - 1) return 1;
+    return read_u16(&dawg[read_u16(edge + 1)]);
+}
+
+// Walks as far along the prefix as the graph goes, returning the number of words that sort before the prefix.
+// node is left pointing to the node reached after length letters, or NULL if there is none.
+static uint16_t dawg_walk(const char *prefix, uint8_t length, const uint8_t **node) {
+    const uint8_t *cur = dawg;
+    uint16_t rank = 0;
+    for(uint8_t depth = 0; depth < length; depth++) {
+        const uint8_t *edge = cur + 2;
+        uint8_t letter = prefix[depth] - 'A';
+        while(true) {
+            uint8_t edge_letter = *edge & DAWG_LETTER;
+            if(edge_letter >= letter) {
+                if(edge_letter > letter) {
+                    *node = NULL;
+                    return rank;
+                }
+                break;
+            }
+            rank += dawg_edge_count(edge, depth);
+            if(*edge & DAWG_LAST_EDGE) {
+                *node = NULL;
+                return rank;
+            }
+            edge += dawg_edge_size(depth);
+        }
+        // The terminal node is never read, so it doesn't need to exist
+        cur = depth == WORD_LENGTH - 1 ? cur : &dawg[read_u16(edge + 1)];
+    }
+    *node = cur;
+    return rank;
+}
+
+static void dawg_get(uint16_t index, char *word) {
+    const uint8_t *node = dawg;
+    for(uint8_t depth = 0; depth < WORD_LENGTH; depth++) {
+        const uint8_t *edge = node + 2;
+        uint16_t count;
+        while(index >= (count = dawg_edge_count(edge, depth))) {
+            index -= count;
+            edge += dawg_edge_size(depth);
+        }
+        word[depth] = 'A' + (*edge & DAWG_LETTER);
+        if(depth != WORD_LENGTH - 1) {
+            node = &dawg[read_u16(edge + 1)];
+        }
+    }
+}
+
+static void build_index(void) {
+    uint16_t bucket = 0;
+    for(uint16_t i = 0; i < num_words; i++) {
+        uint16_t word_bucket = get_bucket(plain_words[i]);
+        while(bucket <= word_bucket) {
+            plain_index[bucket++] = i;
+        }
+    }
+    while(bucket <= NUM_BUCKETS) {
+        plain_index[bucket++] = num_words;
+    }
+    prefix_index = plain_index;
+}
+
+bool wordlist_init(const void *appvar_data) {
+    uint16_t size = *(const uint16_t*)appvar_data;
+    const struct wordlist_header *header = (const void*)((const uint8_t*)appvar_data + 2);
+
+    plain_words = NULL;
+    packed_words = NULL;
+    dawg = NULL;
+
+    if(memcmp(header->magic, WORDLIST_MAGIC, sizeof header->magic) != 0) {
+        plain_words = (const void*)header;
+        num_words = size / WORD_LENGTH;
+        build_index();
+        return true;
+    }
+
+    if(header->version != WORDLIST_VERSION) return false;
+    num_words = header->num_words;
+
+    switch(header->format) {
+        case WORDLIST_PACKED: {
+            prefix_index = (const uint16_t*)(header + 1);
+            packed_words = prefix_index + NUM_BUCKETS + 1;
+            return true;
+        }
+        case WORDLIST_DAWG: {
+            dawg = (const uint8_t*)(header + 1);
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+// First word in [min, max) with a key >= the given key
+static uint16_t search(uint16_t key, uint16_t min, uint16_t max) {
+    while(min < max) {
+        uint16_t mean = (min + max) / 2;
+        if(get_key(mean) < key) min = mean + 1;
+        else max = mean;
+    }
+    return min;
+}
+
+bool is_word_in_list(const char *word) {
+    if(dawg) {
+        const uint8_t *node;
+        dawg_walk(word, WORD_LENGTH, &node);
+        return node;
+    }
+
+    uint16_t bucket = get_bucket(word);
+    uint16_t max = prefix_index[bucket + 1];
+    uint16_t key = pack_suffix(word);
+    uint16_t found = search(key, prefix_index[bucket], max);
+    return found < max && get_key(found) == key;
+}
+
+void wordlist_get(uint16_t index, char *word) {
+    if(plain_words) {
+        memcpy(word, plain_words[index], WORD_LENGTH);
+        return;
+    }
+    if(dawg) {
+        dawg_get(index, word);
+        return;
+    }
+
+    // Find the last bucket starting at or before this word
+    uint16_t min = 0;
+    uint16_t max = NUM_BUCKETS;
+    while(min < max) {
+        uint16_t mean = (min + max + 1) / 2;
+        if(prefix_index[mean] <= index) min = mean;
+        else max = mean - 1;
+    }
+
+    uint16_t key = packed_words[index];
+    word[0] = 'A' + min / NUM_LETTERS;
+    word[1] = 'A' + min % NUM_LETTERS;
+    word[2] = 'A' + (key >> 10);
+    word[3] = 'A' + (key >> 5 & 0x1f);
+    word[4] = 'A' + (key & 0x1f);
+}
+
+uint16_t wordlist_prefix(const char *prefix, uint8_t length, uint16_t *count) {
+    // No word is that long
+    if(length > WORD_LENGTH) {
+        *count = 0;
+        return 0;
+    }
+    if(dawg) {
+        const uint8_t *node;
+        uint16_t first = dawg_walk(prefix, length, &node);
+        if(!node) *count = 0;
+        else if(length == WORD_LENGTH) *count = 1;
+        else *count = read_u16(node);
+        return first;
+    }
+
+    uint16_t min, max;
+    if(length == 0) {
+        min = 0;
+        max = num_words;
+    } else if(length == 1) {
+        min = prefix_index[(prefix[0] - 'A') * NUM_LETTERS];
+        max = prefix_index[(prefix[0] - 'A' + 1) * NUM_LETTERS];
+    } else {
+        uint16_t bucket = get_bucket(prefix);
+        min = prefix_index[bucket];
+        max = prefix_index[bucket + 1];
+        if(length > 2) {
+            // Keys sharing the prefix form a contiguous range, since the first suffix letter is in the high bits
+            char padded[WORD_LENGTH] = {'A', 'A', 'A', 'A', 'A'};
+            memcpy(padded, prefix, length);
+            uint16_t key = pack_suffix(padded);
+            uint16_t span = 1 << 5 * (WORD_LENGTH - length);
+            min = search(key, min, max);
+            max = search(key + span, min, max);
+        }
+    }
+    *count = max - min;
+    return min;
+}
@@ -0,0 +1,43 @@
+#ifndef WORDLE_WORDLIST_H
+#define WORDLE_WORDLIST_H
+
+#include "wordle.h"
+
+// Header of the newer WORDS appvar formats. Older appvars are just the sorted words, with no header.
+struct wordlist_header {
+    char magic[2];
+    uint8_t format;
+    uint8_t version;
+    uint16_t num_words;
+};
+
+#define WORDLIST_MAGIC "WL"
+#define WORDLIST_VERSION 1
+
+enum wordlist_format {
+    // 5 bytes of ASCII per word
+    WORDLIST_PLAIN,
+    // Header, followed by a uint16_t index of the first word for each two letter prefix, followed by the last three
+    // letters of each word packed into a uint16_t, 5 bits per letter with the last letter in the low bits
+    WORDLIST_PACKED,
+    // Header, followed by a directed acyclic word graph with the root node first. Each node is a uint16_t count of
+    // the words below it, followed by its edges in alphabetical order. An edge is a byte holding the letter (0-25),
+    // with the high bit set on the node's last edge, followed by a uint16_t offset of the target node from the root
+    // unless the edge is for the last letter of a word.
+    WORDLIST_DAWG,
+};
+
+extern uint16_t num_words;
+
+// Returns false if the appvar is in a format this version doesn't understand
+bool wordlist_init(const void *appvar_data);
+
+bool is_word_in_list(const char *word);
+
+// Copies the word at index into word, which is not null terminated
+void wordlist_get(uint16_t index, char *word);
+
+// Find the range of words starting with the first length characters of prefix. Empty if length is over WORD_LENGTH.
+uint16_t wordlist_prefix(const char *prefix, uint8_t length, uint16_t *count);
+
+#endif //WORDLE_WORDLIST_H
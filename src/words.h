@@ -3,8 +3,29 @@
 
 #include "wordle.h"
 
-extern const char answers[][WORD_LENGTH + 1];
+// The ANSWERS appvar: this header followed by a uint16_t per day, holding the index of that day's answer in the
+// word list. Only the low 14 bits are used.
+struct answers_header {
+    char magic[3];
+    uint8_t version;
+    // Size of the word list the indices refer to, so that a mismatched pair of appvars can be detected
+    uint16_t num_words;
+    uint16_t num_answers;
+};
 
-extern const uint16_t num_answers;
+#define ANSWERS_MAGIC "ANS"
+#define ANSWERS_VERSION 1
+
+extern uint16_t num_answers;
+
+// Must be called after wordlist_init. Returns false if the appvar is in an unknown format or doesn't match the
+// word list.
+bool answers_init(const void *appvar_data);
+
+// Copies the answer for a day into word, which is not null terminated
+void get_answer(uint16_t day, char *word);
+
+// Index of the answer for a day in the word list
+uint16_t get_answer_index(uint16_t day);
 
 #endif //WORDLE_WORDS_H
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Builds the ANSWERS appvar (see src/words.h) from a list of answers, one per line in day order.
+
+Answers are stored as indices into the word list, so the appvar must be sent along with the same WORDS.8xv."""
+
+import argparse
+import bisect
+import struct
+
+import mkwords
+import tifile
+
+MAGIC = b'ANS'
+VERSION = 1
+MAX_INDEX = 1 << 14
+
+
+def load_answers(path):
+    with open(path) as f:
+        return [line.strip().upper() for line in f if line.strip() and not line.startswith('#')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('words', help='WORDS appvar the answers refer to')
+    parser.add_argument('input')
+    parser.add_argument('output')
+    args = parser.parse_args()
+
+    words = sorted(mkwords.load_words(args.words))
+    answers = load_answers(args.input)
+
+    indices = []
+    for answer in answers:
+        index = bisect.bisect_left(words, answer)
+        if index == len(words) or words[index] != answer:
+            raise ValueError(f'{answer} is not in the word list')
+        if index >= MAX_INDEX:
+            raise ValueError(f'{answer} has an index too large to store')
+        indices.append(index)
+
+    contents = MAGIC + struct.pack('<BHH', VERSION, len(words), len(answers)) + \
+        struct.pack(f'<{len(indices)}H', *indices)
+    tifile.write_appvar(args.output, 'ANSWERS', contents)
+    print(f'{args.output}: {len(answers)} answers, {len(contents)} bytes')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Builds the HINTS appvar (see src/hint.h), a decision tree giving the next guess for every answer.
+
+Each guess is picked greedily, as the one whose feedback has the most entropy over the answers that are left, scored
+the same way as the game's own search (see src/hint.c). By default only answers are tried as guesses; --all-guesses
+tries the whole word list, which gives a slightly better tree but takes several times as long to build.
+
+Like ANSWERS, guesses are stored as indices into the word list, so the appvar must be sent along with the same
+WORDS.8xv."""
+
+import argparse
+import struct
+from collections import Counter
+
+import mkanswers
+import mkwords
+import tifile
+
+MAGIC = b'HNT'
+VERSION = 1
+WORD_LENGTH = 5
+SCORE_CORRECT = 3 ** WORD_LENGTH - 1
+NODE_LEAF = 0x8000
+MAX_INDEX = 1 << 14
+LOG_BITS = 8
+
+
+def log2_fixed(n):
+    """log2(n) with LOG_BITS fractional bits, matching log2_fixed in src/hint.c"""
+    whole = n.bit_length() - 1
+    x = (n << 15) >> whole
+    result = whole << LOG_BITS
+    for bit in range(LOG_BITS - 1, -1, -1):
+        x = x * x >> 15
+        if x >= 2 << 15:
+            x >>= 1
+            result |= 1 << bit
+    return result
+
+
+def score_guess(guess, answer):
+    """Feedback as a packed base 3 number, matching score_guess in src/game.c"""
+    remaining = Counter(a for g, a in zip(guess, answer) if g != a)
+    score = 0
+    place = 1
+    for g, a in zip(guess, answer):
+        if g == a:
+            score += 2 * place
+        elif remaining[g] > 0:
+            score += place
+        # Every earlier tile with the same letter uses one up, whatever its color
+        remaining[g] -= 1
+        place *= 3
+    return score
+
+
+class Builder:
+    def __init__(self, words, answers, guesses):
+        self.words = words
+        self.answers = answers
+        self.guesses = guesses
+        # Feedback for each guess against each answer, by position in self.answers
+        self.scores = {g: bytes(score_guess(words[g], words[a]) for a in answers) for g in guesses}
+        self.logs = [0] + [log2_fixed(n) for n in range(1, len(answers) + 1)]
+        self.nodes = 0
+        # Number of guesses needed for each answer, including the final one
+        self.depths = []
+
+    def cost(self, guess, subset):
+        """Sum of n log2 n over the feedback buckets - the lowest cost has the highest entropy"""
+        row = self.scores[guess]
+        return sum(n * self.logs[n] for n in Counter(map(row.__getitem__, subset)).values())
+
+    def build(self, subset, depth=1):
+        """Returns (guess, {score: child}) for a list of positions in self.answers. A child is a node, or the word
+        index of the only answer left."""
+        self.nodes += 1
+        # Possible answers are tried first, so that they win ties
+        order = [self.answers[i] for i in subset] + self.guesses
+        best = min(order, key=lambda g: self.cost(g, subset))
+
+        row = self.scores[best]
+        buckets = {}
+        for i in subset:
+            buckets.setdefault(row[i], []).append(i)
+        if buckets.pop(SCORE_CORRECT, None):
+            self.depths.append(depth)
+        children = {}
+        for score, rest in sorted(buckets.items()):
+            if len(rest) == 1:
+                children[score] = self.answers[rest[0]]
+                self.depths.append(depth + 1)
+            else:
+                children[score] = self.build(rest, depth + 1)
+        return best, children
+
+
+def encode(root):
+    data = bytearray()
+
+    def write(node):
+        guess, children = node
+        offset = len(data)
+        data.extend(struct.pack('<HB', guess, len(children)))
+        table = len(data)
+        data.extend(bytes(3 * len(children)))
+        for i, (score, child) in enumerate(children.items()):
+            value = write(child) if isinstance(child, tuple) else NODE_LEAF | child
+            struct.pack_into('<BH', data, table + 3 * i, score, value)
+        if len(data) > NODE_LEAF:
+            raise ValueError('tree is too large to address')
+        return offset
+
+    write(root)
+    return bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--all-guesses', action='store_true', help='try every word as a guess, not just answers')
+    parser.add_argument('words', help='WORDS appvar the tree refers to')
+    parser.add_argument('input', help='list of answers, one per line')
+    parser.add_argument('output')
+    args = parser.parse_args()
+
+    words = sorted(mkwords.load_words(args.words))
+    index = {word: i for i, word in enumerate(words)}
+    answers = []
+    for answer in dict.fromkeys(mkanswers.load_answers(args.input)):
+        if answer not in index:
+            raise ValueError(f'{answer} is not in the word list')
+        if index[answer] >= MAX_INDEX:
+            raise ValueError(f'{answer} has an index too large to store')
+        answers.append(index[answer])
+    answers.sort()
+    guesses = list(range(len(words))) if args.all_guesses else answers
+
+    builder = Builder(words, answers, guesses)
+    root = builder.build(list(range(len(answers))))
+
+    contents = MAGIC + struct.pack('<BH', VERSION, len(words)) + encode(root)
+    tifile.write_appvar(args.output, 'HINTS', contents)
+    counts = builder.depths
+    print(f'{args.output}: {builder.nodes} nodes, opening with {words[root[0]]}, '
+          f'{sum(counts) / len(counts):.3f} guesses on average, at most {max(counts)}, {len(contents)} bytes')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Converts the word list between the WORDS appvar formats understood by the game (see src/wordlist.h).
+
+The input may be an existing WORDS.8xv in any format, or a text file with one word per line."""
+
+import argparse
+import struct
+
+import tifile
+
+MAGIC = b'WL'
+VERSION = 1
+FORMATS = ['plain', 'packed', 'dawg']
+DAWG_LAST_EDGE = 0x80
+NUM_LETTERS = 26
+WORD_LENGTH = 5
+
+
+def letter(c):
+    return ord(c) - ord('A')
+
+
+def bucket(word):
+    return letter(word[0]) * NUM_LETTERS + letter(word[1])
+
+
+def pack_suffix(word):
+    return letter(word[2]) << 10 | letter(word[3]) << 5 | letter(word[4])
+
+
+def load_words(path):
+    if not path.endswith('.8xv'):
+        with open(path) as f:
+            return sorted({line.strip().upper() for line in f if line.strip()})
+
+    data = tifile.read_appvar(path)
+    if data[:2] != MAGIC:
+        return [data[i:i + WORD_LENGTH].decode('ascii') for i in range(0, len(data), WORD_LENGTH)]
+
+    _, fmt, version, num_words = struct.unpack_from('<2sBBH', data, 0)
+    if version != VERSION:
+        raise ValueError(f'unsupported word list version {version}')
+    if FORMATS[fmt] == 'packed':
+        index = struct.unpack_from(f'<{NUM_LETTERS ** 2 + 1}H', data, 6)
+        keys = struct.unpack_from(f'<{num_words}H', data, 6 + 2 * len(index))
+        words = []
+        for b in range(NUM_LETTERS ** 2):
+            prefix = chr(ord('A') + b // NUM_LETTERS) + chr(ord('A') + b % NUM_LETTERS)
+            for key in keys[index[b]:index[b + 1]]:
+                words.append(prefix + ''.join(chr(ord('A') + (key >> shift & 0x1f)) for shift in (10, 5, 0)))
+        return words
+    if FORMATS[fmt] == 'dawg':
+        return list(walk_dawg(data[6:], 0, 0, ''))
+    raise ValueError(f'unsupported word list format {fmt}')
+
+
+def walk_dawg(dawg, offset, depth, prefix):
+    edge = offset + 2
+    while True:
+        word = prefix + chr(ord('A') + (dawg[edge] & 0x1f))
+        if depth == WORD_LENGTH - 1:
+            yield word
+            size = 1
+        else:
+            yield from walk_dawg(dawg, struct.unpack_from('<H', dawg, edge + 1)[0], depth + 1, word)
+            size = 3
+        if dawg[edge] & DAWG_LAST_EDGE:
+            return
+        edge += size
+
+
+def encode_dawg(words):
+    # In a graph of fixed length words, two prefixes can share a node exactly when they are followed by the same set
+    # of suffixes, so identify each node by that set
+    suffixes = {}
+    for word in words:
+        for depth in range(WORD_LENGTH):
+            suffixes.setdefault(word[:depth], set()).add(word[depth:])
+    levels = [sorted({tuple(sorted(s)) for p, s in suffixes.items() if len(p) == depth}) for depth in range(WORD_LENGTH)]
+
+    def edges(node):
+        children = {}
+        for suffix in node:
+            children.setdefault(suffix[0], []).append(suffix[1:])
+        return sorted(children.items())
+
+    offsets = {}
+    offset = 0
+    for depth, level in enumerate(levels):
+        edge_size = 1 if depth == WORD_LENGTH - 1 else 3
+        for node in level:
+            offsets[node] = offset
+            offset += 2 + edge_size * len(edges(node))
+    if offset > 0xffff:
+        raise ValueError('word list is too large for a DAWG')
+
+    data = bytearray()
+    for depth, level in enumerate(levels):
+        for node in level:
+            data += struct.pack('<H', len(node))
+            node_edges = edges(node)
+            for i, (c, rest) in enumerate(node_edges):
+                data.append(letter(c) | (DAWG_LAST_EDGE if i == len(node_edges) - 1 else 0))
+                if depth != WORD_LENGTH - 1:
+                    data += struct.pack('<H', offsets[tuple(rest)])
+    return bytes(data)
+
+
+def encode(words, fmt):
+    if fmt == 'plain':
+        return ''.join(words).encode('ascii')
+
+    header = MAGIC + struct.pack('<BBH', FORMATS.index(fmt), VERSION, len(words))
+    if fmt == 'packed':
+        index = []
+        for i, word in enumerate(words):
+            while len(index) <= bucket(word):
+                index.append(i)
+        while len(index) <= NUM_LETTERS ** 2:
+            index.append(len(words))
+        return header + struct.pack(f'<{len(index)}H', *index) + \
+            struct.pack(f'<{len(words)}H', *map(pack_suffix, words))
+    if fmt == 'dawg':
+        return header + encode_dawg(words)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--format', choices=FORMATS, default='packed')
+    parser.add_argument('input')
+    parser.add_argument('output')
+    args = parser.parse_args()
+
+    words = sorted(load_words(args.input))
+    for word in words:
+        if len(word) != WORD_LENGTH or not word.isalpha() or not word.isupper():
+            raise ValueError(f'invalid word {word!r}')
+
+    contents = encode(words, args.format)
+    tifile.write_appvar(args.output, 'WORDS', contents)
+    print(f'{args.output}: {len(words)} words, {len(contents)} bytes')
+
+
+if __name__ == '__main__':
+    main()
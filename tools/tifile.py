@@ -0,0 +1,32 @@
+"""Reading and writing TI-84 Plus CE appvar (.8xv) files."""
+
+import struct
+
+SIGNATURE = b'**TI83F*\x1a\x0a\x00'
+TYPE_APPVAR = 0x15
+FLAG_ARCHIVED = 0x80
+
+
+def read_appvar(path):
+    """Returns the contents of an appvar, without the size word."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if not data.startswith(SIGNATURE):
+        raise ValueError(f'{path} is not a TI variable file')
+    entry = data[55:]
+    header_length, = struct.unpack_from('<H', entry, 0)
+    var_length, = struct.unpack_from('<H', entry, 2 + header_length)
+    var_data = entry[4 + header_length:4 + header_length + var_length]
+    size, = struct.unpack_from('<H', var_data, 0)
+    return var_data[2:2 + size]
+
+
+def write_appvar(path, name, contents, archived=True):
+    if len(contents) > 0xffff - 2:
+        raise ValueError(f'{name} is too large for an appvar')
+    var_data = struct.pack('<H', len(contents)) + contents
+    entry = struct.pack('<HHB8sBBH', 13, len(var_data), TYPE_APPVAR, name.encode('ascii'), 0,
+                        FLAG_ARCHIVED if archived else 0, len(var_data)) + var_data
+    with open(path, 'wb') as f:
+        f.write(SIGNATURE + bytes(42) + struct.pack('<H', len(entry)) + entry)
+        f.write(struct.pack('<H', sum(entry) & 0xffff))